@@ -18,6 +18,7 @@
 
 #include "app/aircopy.h"
 #include "audio.h"
+#include "board.h"
 #include "driver/bk4819.h"
 #include "driver/crc.h"
 #include "driver/eeprom.h"
@@ -97,6 +98,9 @@ void AIRCOPY_StorePacket(void)
 				for (i = 0; i < 8; i++)
 				{
 					EEPROM_WriteBuffer(Offset, pData);
+					#ifdef ENABLE_CHANNEL_TABLE
+						BOARD_UpdateChannelTable(Offset, pData);
+					#endif
 					pData  += 4;
 					Offset += 8;
 				}
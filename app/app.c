@@ -23,6 +23,9 @@
 #include "app/app.h"
 #include "app/chFrScanner.h"
 #include "app/dtmf.h"
+#ifdef ENABLE_ADAPTIVE_DUAL_WATCH
+	#include "app/dualwatch.h"
+#endif
 #ifdef ENABLE_FMRADIO
 	#include "app/fm.h"
 #endif
@@ -40,6 +43,7 @@
 	#include "driver/bk1080.h"
 #endif
 #include "driver/bk4819.h"
+#include "driver/eeprom.h"
 #include "driver/gpio.h"
 #include "driver/keyboard.h"
 #include "driver/st7565.h"
@@ -63,6 +67,13 @@
 #include "ui/status.h"
 #include "ui/ui.h"
 
+#ifdef ENABLE_ADAPTIVE_DUAL_WATCH
+	// the main (TX) VFO is the priority one
+	#define DUAL_WATCH_DWELL_10MS   DUALWATCH_Dwell_10ms(gEeprom.RX_VFO, gEeprom.DUAL_WATCH - DUAL_WATCH_CHAN_A)
+#else
+	#define DUAL_WATCH_DWELL_10MS   dual_watch_count_toggle_10ms
+#endif
+
 static void ProcessKey(KEY_Code_t Key, bool bKeyPressed, bool bKeyHeld);
 static void FlashlightTimeSlice();
 
@@ -134,6 +145,10 @@ static void CheckForIncoming(void)
 		gDualWatchCountdown_10ms = dual_watch_count_after_rx_10ms;
 		gScheduleDualWatch       = false;
 
+		#ifdef ENABLE_ADAPTIVE_DUAL_WATCH
+			DUALWATCH_SquelchOpened(gEeprom.RX_VFO);
+		#endif
+
 		// let the user see DW is not active
 		gDualWatchActive = false;
 		gUpdateStatus    = true;
@@ -241,6 +256,15 @@ static void HandleIncoming(void)
 	APP_StartListening(gMonitor ? FUNCTION_MONITOR : FUNCTION_RECEIVE, false);
 }
 
+#ifdef ENABLE_TASK_SCHEDULER
+	static void TailNoteEliminationComplete(void)
+	{
+		gFlagTailNoteEliminationComplete = true;
+	}
+
+	SCHEDULER_Task_t gTailNoteEliminationTask = SCHEDULER_TASK(TailNoteEliminationComplete, SCHEDULER_PRIORITY_HIGH);
+#endif
+
 static void HandleReceive(void)
 {
 	#define END_OF_RX_MODE_SKIP 0
@@ -411,7 +435,11 @@ Skip:
 			{
 				AUDIO_AudioPathOff();
 
-				gTailNoteEliminationCountdown_10ms = 20;
+				#ifdef ENABLE_TASK_SCHEDULER
+					SCHEDULER_Start(&gTailNoteEliminationTask, 20, 0);
+				#else
+					gTailNoteEliminationCountdown_10ms = 20;
+				#endif
 				gFlagTailNoteEliminationComplete   = false;
 				gEndOfRxDetectedMaybe = true;
 				gEnableSpeaker        = false;
@@ -613,9 +641,9 @@ static void DualwatchAlternate(void)
 	RADIO_SetupRegisters(false);
 
 	#ifdef ENABLE_NOAA
-		gDualWatchCountdown_10ms = gIsNoaaMode ? dual_watch_count_noaa_10ms : dual_watch_count_toggle_10ms;
+		gDualWatchCountdown_10ms = gIsNoaaMode ? dual_watch_count_noaa_10ms : DUAL_WATCH_DWELL_10MS;
 	#else
-		gDualWatchCountdown_10ms = dual_watch_count_toggle_10ms;
+		gDualWatchCountdown_10ms = DUAL_WATCH_DWELL_10MS;
 	#endif
 }
 
@@ -624,6 +652,14 @@ static void CheckRadioInterrupts(void)
 	if (SCANNER_IsScanning())
 		return;
 
+#ifdef ENABLE_BK4819_IRQ_QUEUE
+	BK4819_IrqEvent_t Event;
+
+	while (BK4819_GetInterrupt(&Event))
+	{	// BK chip interrupt request, already fetched by the systick poll
+
+		const uint16_t interrupt_status_bits = Event.Status;
+#else
 	while (BK4819_ReadRegister(BK4819_REG_0C) & 1u)
 	{	// BK chip interrupt request
 
@@ -634,6 +670,7 @@ static void CheckRadioInterrupts(void)
 
 		// fetch the interrupt status bits
 		interrupt_status_bits = BK4819_ReadRegister(BK4819_REG_02);
+#endif
 
 		// 0 = no phase shift
 		// 1 = 120deg phase shift
@@ -645,7 +682,11 @@ static void CheckRadioInterrupts(void)
 
 		if (interrupt_status_bits & BK4819_REG_02_DTMF_5TONE_FOUND)
 		{	// save the RX'ed DTMF character
-			const char c = DTMF_GetCharacter(BK4819_GetDTMF_5TONE_Code());
+			#ifdef ENABLE_BK4819_IRQ_QUEUE
+				const char c = DTMF_GetCharacter(Event.DTMFCode);
+			#else
+				const char c = DTMF_GetCharacter(BK4819_GetDTMF_5TONE_Code());
+			#endif
 			if (c != 0xff)
 			{
 				if (gCurrentFunction != FUNCTION_TRANSMIT)
@@ -688,7 +729,11 @@ static void CheckRadioInterrupts(void)
 		if (interrupt_status_bits & BK4819_REG_02_CDCSS_LOST)
 		{
 			g_CDCSS_Lost = true;
-			gCDCSSCodeType = BK4819_GetCDCSSCodeType();
+			#ifdef ENABLE_BK4819_IRQ_QUEUE
+				gCDCSSCodeType = Event.CDCSSCodeType;
+			#else
+				gCDCSSCodeType = BK4819_GetCDCSSCodeType();
+			#endif
 		}
 
 		if (interrupt_status_bits & BK4819_REG_02_CDCSS_FOUND)
@@ -850,7 +895,7 @@ void APP_EndTransmission(void)
 
 void APP_Update(void)
 {
-#ifdef ENABLE_VOICE
+#if defined(ENABLE_VOICE) && !defined(ENABLE_TASK_SCHEDULER)
 	if (gFlagPlayQueuedVoice) {
 			AUDIO_PlayQueuedVoice();
 			gFlagPlayQueuedVoice = false;
@@ -874,6 +919,11 @@ void APP_Update(void)
 	if (gReducedService)
 		return;
 
+	#ifdef ENABLE_BK4819_IRQ_QUEUE
+		// handle chip interrupts as soon as the systick poll has queued them
+		CheckRadioInterrupts();
+	#endif
+
 	if (gCurrentFunction != FUNCTION_TRANSMIT)
 		HandleFunction();
 
@@ -1045,7 +1095,11 @@ void APP_Update(void)
 
 			// go back to sleep
 
-			gPowerSave_10ms = gEeprom.BATTERY_SAVE * 10;
+			#ifdef ENABLE_ADAPTIVE_DUAL_WATCH
+				gPowerSave_10ms = DUALWATCH_PowerSaveSleep_10ms(gEeprom.BATTERY_SAVE * 10);
+			#else
+				gPowerSave_10ms = gEeprom.BATTERY_SAVE * 10;
+			#endif
 			gRxIdleMode     = true;
 
 			BK4819_DisableVox();
@@ -1202,8 +1256,10 @@ void APP_TimeSlice10ms(void)
 	if (gReducedService)
 		return;
 
-	if (gCurrentFunction != FUNCTION_POWER_SAVE || !gRxIdleMode)
-		CheckRadioInterrupts();
+	#ifndef ENABLE_BK4819_IRQ_QUEUE
+		if (gCurrentFunction != FUNCTION_POWER_SAVE || !gRxIdleMode)
+			CheckRadioInterrupts();
+	#endif
 
 	if (gCurrentFunction == FUNCTION_TRANSMIT)
 	{	// transmitting
@@ -1213,14 +1269,7 @@ void APP_TimeSlice10ms(void)
 		#endif
 	}
 
-	if (gUpdateDisplay)
-	{
-		gUpdateDisplay = false;
-		GUI_DisplayScreen();
-	}
-
-	if (gUpdateStatus)
-		UI_DisplayStatus();
+	GUI_ServiceRedraw();
 
 	// Skipping authentic device checks
 
@@ -1370,6 +1419,10 @@ void APP_TimeSlice500ms(void)
 		if (--gKeypadLocked == 0)
 			gUpdateDisplay = true;
 
+	#ifdef ENABLE_ADAPTIVE_DUAL_WATCH
+		DUALWATCH_TimeSlice500ms();
+	#endif
+
 	if (gKeyInputCountdown > 0)
 	{
 		if (--gKeyInputCountdown == 0)
@@ -1442,6 +1495,10 @@ void APP_TimeSlice500ms(void)
 
 		if (gBatteryCurrent > 500 || gBatteryCalibration[3] < gBatteryCurrentVoltage)
 		{
+			#ifdef ENABLE_EEPROM_WRITE_BEHIND
+				EEPROM_Flush();
+			#endif
+
 			#ifdef ENABLE_OVERLAY
 				overlay_FLASH_RebootToBootloader();
 			#else
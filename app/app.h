@@ -22,6 +22,11 @@
 #include "functions.h"
 #include "frequencies.h"
 #include "radio.h"
+#ifdef ENABLE_TASK_SCHEDULER
+	#include "scheduler.h"
+
+	extern SCHEDULER_Task_t gTailNoteEliminationTask;
+#endif
 
 void     APP_EndTransmission(void);
 void     APP_StartListening(FUNCTION_Type_t Function, const bool reset_am_fix);
@@ -1,6 +1,11 @@
 
+#include <string.h>
+
 #include "app/app.h"
 #include "app/chFrScanner.h"
+#ifdef ENABLE_ADAPTIVE_SCAN_DWELL
+	#include "app/scandwell.h"
+#endif
 #include "functions.h"
 #include "misc.h"
 #include "settings.h"
@@ -22,15 +27,188 @@ uint32_t            initialFrqOrChan;
 uint8_t           	initialCROSS_BAND_RX_TX;
 uint32_t            lastFoundFrqOrChan;
 
+#ifdef ENABLE_SCAN_PLAN
+	// a memory channel decoded for receiving, what a scan step puts in the RX VFO. The TX side and the
+	// name are left alone, CHFRSCANNER_Stop()/CHFRSCANNER_Cancel() configure the channel the scan ends on
+	typedef struct {
+		uint32_t Frequency;         // the one the channel receives on, pRX
+		uint8_t  Channel;
+		uint8_t  Code;              // pRX CTCSS/DCS code
+		uint8_t  CodeType   : 2;
+		uint8_t  Band       : 3;
+		uint8_t  Bandwidth  : 1;
+		uint8_t  Compander  : 2;
+		uint8_t  Modulation : 3;
+		uint8_t  Scrambling : 4;
+		uint8_t  DtmfDecode : 1;
+	} ScanRecord_t;
+
+	_Static_assert(sizeof(ScanRecord_t) == 8, "scan record grew");
+
+	// the channels a memory scan visits, in scan order, found and decoded once when the scan starts so a
+	// step is an index into the plan plus the register writes, no RADIO_FindNextChannel() walk and no
+	// RADIO_ConfigureChannel(). 1.6 kB for all 200 channels
+	static ScanRecord_t gScanPlan[MR_CHANNEL_LAST + 1];
+	static unsigned int gScanPlanLength;
+	static unsigned int gScanPlanIndex;
+
+	// the scan list's priority channels, Channel is 0xFF if there isn't one
+	static ScanRecord_t gScanPriority[2];
+
+	// squelch thresholds below and above 174MHz, they only depend on that and the squelch level
+	static uint8_t      gScanSquelch[2][6];
+#endif
+
+#ifdef ENABLE_ADAPTIVE_SCAN_DWELL
+	#define SCAN_DWELL_10MS(full_10ms)   SCANDWELL_Begin(full_10ms)
+#else
+	#define SCAN_DWELL_10MS(full_10ms)   (full_10ms)
+#endif
+
 static void NextFreqChannel(void);
 static void NextMemChannel(void);
 
+#ifdef ENABLE_SCAN_PLAN
+static void DecodeChannel(ScanRecord_t *pRecord, const uint8_t Channel)
+{	// RADIO_ConfigureChannel() does the decoding and range checks in the RX VFO, the record keeps
+	// what receiving needs. With the channel table and the calibration cache the only EEPROM read
+	// left in there is the name, once per channel when the scan starts
+	const VFO_Info_t *pInfo = gRxVfo;
+	uint8_t          *pSquelch;
+
+	gEeprom.ScreenChannel[gEeprom.RX_VFO] = Channel;
+	RADIO_ConfigureChannel(gEeprom.RX_VFO, VFO_CONFIGURE_RELOAD);
+
+	pRecord->Frequency  = pInfo->pRX->Frequency;
+	pRecord->Channel    = pInfo->CHANNEL_SAVE;
+	pRecord->Code       = pInfo->pRX->Code;
+	pRecord->CodeType   = pInfo->pRX->CodeType;
+	pRecord->Band       = pInfo->Band;
+	pRecord->Bandwidth  = pInfo->CHANNEL_BANDWIDTH;
+	pRecord->Compander  = pInfo->Compander;
+	pRecord->Modulation = pInfo->Modulation;
+	pRecord->Scrambling = pInfo->SCRAMBLING_TYPE;
+	pRecord->DtmfDecode = pInfo->DTMF_DECODING_ENABLE;
+
+	pSquelch    = gScanSquelch[(FREQUENCY_GetBand(pRecord->Frequency) < BAND4_174MHz) ? 1 : 0];
+	pSquelch[0] = pInfo->SquelchOpenRSSIThresh;
+	pSquelch[1] = pInfo->SquelchCloseRSSIThresh;
+	pSquelch[2] = pInfo->SquelchOpenNoiseThresh;
+	pSquelch[3] = pInfo->SquelchCloseNoiseThresh;
+	pSquelch[4] = pInfo->SquelchCloseGlitchThresh;
+	pSquelch[5] = pInfo->SquelchOpenGlitchThresh;
+}
+
+static void BuildScanPlan(void)
+{
+	const bool    bCheckScanList = gEeprom.SCAN_LIST_DEFAULT < 2;
+	const uint8_t StartChannel   = gNextMrChannel;
+	uint8_t       Channel        = gNextMrChannel;
+	unsigned int  i;
+
+	gScanPlanLength = 0;
+	gScanPlanIndex  = 0;
+
+	// same order RADIO_FindNextChannel() would give, starting after the current channel
+	for (i = 0; IS_MR_CHANNEL(i); i++)
+	{
+		Channel += gScanStateDir;
+		if (Channel == 0xFF)
+			Channel = MR_CHANNEL_LAST;
+		else
+		if (!IS_MR_CHANNEL(Channel))
+			Channel = MR_CHANNEL_FIRST;
+
+		if (RADIO_CheckValidChannel(Channel, bCheckScanList, gEeprom.SCAN_LIST_DEFAULT))
+			DecodeChannel(&gScanPlan[gScanPlanLength++], Channel);
+	}
+
+	// NextMemChannel() visits these between the planned ones
+	for (i = 0; i < ARRAY_SIZE(gScanPriority); i++)
+	{
+		Channel = 0xFF;
+		if (bCheckScanList)
+			Channel = (i == 0) ? gEeprom.SCANLIST_PRIORITY_CH1[gEeprom.SCAN_LIST_DEFAULT] : gEeprom.SCANLIST_PRIORITY_CH2[gEeprom.SCAN_LIST_DEFAULT];
+
+		gScanPriority[i].Channel = 0xFF;
+		if (RADIO_CheckValidChannel(Channel, false, 0))
+			DecodeChannel(&gScanPriority[i], Channel);
+	}
+
+	// the decoding went through the RX VFO, put the channel the scan starts from back in it
+	gEeprom.MrChannel[gEeprom.RX_VFO]     = StartChannel;
+	gEeprom.ScreenChannel[gEeprom.RX_VFO] = StartChannel;
+	RADIO_ConfigureChannel(gEeprom.RX_VFO, VFO_CONFIGURE_RELOAD);
+}
+
+static const ScanRecord_t *NextPlannedRecord(void)
+{
+	if (gScanPlanLength == 0)
+		return NULL;
+
+	if (gScanPlanIndex >= gScanPlanLength)
+		gScanPlanIndex = 0;
+
+	return &gScanPlan[gScanPlanIndex++];
+}
+
+static const ScanRecord_t *PriorityRecord(const unsigned int Index, const int Channel)
+{
+	return (gScanPriority[Index].Channel == Channel) ? &gScanPriority[Index] : NULL;
+}
+
+static void TuneRecord(const ScanRecord_t *pRecord)
+{	// only the RX side, the TX side is simplex on the receive frequency until the scan ends
+	VFO_Info_t    *pInfo    = gRxVfo;
+	const uint8_t *pSquelch = gScanSquelch[(FREQUENCY_GetBand(pRecord->Frequency) < BAND4_174MHz) ? 1 : 0];
+
+	pInfo->CHANNEL_SAVE                  = pRecord->Channel;
+	pInfo->Band                          = pRecord->Band;
+	pInfo->freq_config_RX.Frequency      = pRecord->Frequency;
+	pInfo->freq_config_RX.CodeType       = pRecord->CodeType;
+	pInfo->freq_config_RX.Code           = pRecord->Code;
+	pInfo->freq_config_TX                = pInfo->freq_config_RX;
+	pInfo->pRX                           = &pInfo->freq_config_RX;
+	pInfo->pTX                           = &pInfo->freq_config_TX;
+	pInfo->FrequencyReverse              = false;
+	pInfo->TX_OFFSET_FREQUENCY_DIRECTION = TX_OFFSET_FREQUENCY_DIRECTION_OFF;
+	pInfo->CHANNEL_BANDWIDTH             = pRecord->Bandwidth;
+	pInfo->Compander                     = pRecord->Compander;
+	pInfo->Modulation                    = pRecord->Modulation;
+	pInfo->SCRAMBLING_TYPE               = pRecord->Scrambling;
+	pInfo->DTMF_DECODING_ENABLE          = pRecord->DtmfDecode;
+
+	pInfo->SquelchOpenRSSIThresh         = pSquelch[0];
+	pInfo->SquelchCloseRSSIThresh        = pSquelch[1];
+	pInfo->SquelchOpenNoiseThresh        = pSquelch[2];
+	pInfo->SquelchCloseNoiseThresh       = pSquelch[3];
+	pInfo->SquelchCloseGlitchThresh      = pSquelch[4];
+	pInfo->SquelchOpenGlitchThresh       = pSquelch[5];
+
+	memset(pInfo->Name, 0, sizeof(pInfo->Name));
+
+	RADIO_SetupRegisters(true);
+}
+
+void CHFRSCANNER_Cancel(void)
+{	// the scan ends without CHFRSCANNER_Stop(), a memory scan left only the RX side of the channel in the VFO
+	if (gScanStateDir != SCAN_OFF && IS_MR_CHANNEL(gNextMrChannel))
+		RADIO_ConfigureChannel(gEeprom.RX_VFO, VFO_CONFIGURE_RELOAD);
+
+	RADIO_CacheCalibration(false);
+}
+#endif
+
 void CHFRSCANNER_Start(const bool storeBackupSettings, const int8_t scan_direction)
 {
 	if (storeBackupSettings) {
 		initialCROSS_BAND_RX_TX = gEeprom.CROSS_BAND_RX_TX;
 		gEeprom.CROSS_BAND_RX_TX = CROSS_BAND_OFF;
 		gScanKeepResult = false;
+
+		#ifdef ENABLE_ADAPTIVE_SCAN_DWELL
+			SCANDWELL_ResetStats();
+		#endif
 	}
 	
 	RADIO_SelectVfos();
@@ -45,6 +223,10 @@ void CHFRSCANNER_Start(const bool storeBackupSettings, const int8_t scan_directi
 			initialFrqOrChan = gRxVfo->CHANNEL_SAVE;
 			lastFoundFrqOrChan = initialFrqOrChan;
 		}
+#ifdef ENABLE_SCAN_PLAN
+		RADIO_CacheCalibration(true);
+		BuildScanPlan();
+#endif
 		NextMemChannel();
 	}
 	else
@@ -64,6 +246,20 @@ void CHFRSCANNER_Start(const bool storeBackupSettings, const int8_t scan_directi
 
 void CHFRSCANNER_ContinueScanning(void)
 {
+#ifdef ENABLE_ADAPTIVE_SCAN_DWELL
+	if (gCurrentFunction != FUNCTION_INCOMING)
+	{	// the probe found the channel anything but clearly empty, give it the rest of the dwell
+		const uint16_t Extend_10ms = SCANDWELL_Extend_10ms();
+
+		if (Extend_10ms > 0)
+		{
+			gScanPauseDelayIn_10ms = Extend_10ms;
+			gScheduleScanListen    = false;
+			return;
+		}
+	}
+#endif
+
 	if (IS_FREQ_CHANNEL(gNextMrChannel))
 	{
 		if (gCurrentFunction == FUNCTION_INCOMING)
@@ -113,6 +309,10 @@ void CHFRSCANNER_Found(void)
 
 
 	gScanKeepResult = true;
+
+#ifdef ENABLE_ADAPTIVE_SCAN_DWELL
+	SCANDWELL_SignalFound();
+#endif
 }
 
 void CHFRSCANNER_Stop(void)
@@ -124,6 +324,14 @@ void CHFRSCANNER_Stop(void)
 	
 	gScanStateDir = SCAN_OFF;
 
+#ifdef ENABLE_SCAN_PLAN
+	RADIO_CacheCalibration(false);
+#endif
+
+#if defined(ENABLE_ADAPTIVE_SCAN_DWELL) && defined(ENABLE_UART)
+	SCANDWELL_SendStats();
+#endif
+
 	const uint32_t chFr = gScanKeepResult ? lastFoundFrqOrChan : initialFrqOrChan;
 	const bool channelChanged = chFr != initialFrqOrChan;
 	if (IS_MR_CHANNEL(gNextMrChannel)) {
@@ -158,9 +366,9 @@ static void NextFreqChannel(void)
 	RADIO_SetupRegisters(true);
 
 #ifdef ENABLE_FASTER_CHANNEL_SCAN
-	gScanPauseDelayIn_10ms = 9;   // 90ms
+	gScanPauseDelayIn_10ms = SCAN_DWELL_10MS(9);   // 90ms
 #else
-	gScanPauseDelayIn_10ms = scan_pause_delay_in_6_10ms;
+	gScanPauseDelayIn_10ms = SCAN_DWELL_10MS(scan_pause_delay_in_6_10ms);
 #endif
 
 	gUpdateDisplay     = true;
@@ -174,6 +382,9 @@ static void NextMemChannel(void)
 	const int           chan2        = (gEeprom.SCAN_LIST_DEFAULT < 2) ? gEeprom.SCANLIST_PRIORITY_CH2[gEeprom.SCAN_LIST_DEFAULT] : -1;
 	const unsigned int  prev_chan    = gNextMrChannel;
 	unsigned int        chan         = 0;
+#ifdef ENABLE_SCAN_PLAN
+	const ScanRecord_t *pRecord      = NULL;
+#endif
 
 	if (enabled)
 	{
@@ -188,6 +399,9 @@ static void NextMemChannel(void)
 					{
 						currentScanList = SCAN_NEXT_CHAN_SCANLIST1;
 						gNextMrChannel   = chan1;
+						#ifdef ENABLE_SCAN_PLAN
+							pRecord = PriorityRecord(0, chan1);
+						#endif
 						break;
 					}
 				}
@@ -199,6 +413,9 @@ static void NextMemChannel(void)
 					{
 						currentScanList = SCAN_NEXT_CHAN_SCANLIST2;
 						gNextMrChannel   = chan2;
+						#ifdef ENABLE_SCAN_PLAN
+							pRecord = PriorityRecord(1, chan2);
+						#endif
 						break;
 					}
 				}
@@ -230,7 +447,12 @@ static void NextMemChannel(void)
 
 	if (!enabled || chan == 0xff)
 	{
+#ifdef ENABLE_SCAN_PLAN
+		pRecord = NextPlannedRecord();
+		chan    = (pRecord != NULL) ? pRecord->Channel : 0xFF;
+#else
 		chan = RADIO_FindNextChannel(gNextMrChannel + gScanStateDir, gScanStateDir, (gEeprom.SCAN_LIST_DEFAULT < 2) ? true : false, gEeprom.SCAN_LIST_DEFAULT);
+#endif
 		if (chan == 0xFF)
 		{	// no valid channel found
 			chan = MR_CHANNEL_FIRST;
@@ -244,16 +466,23 @@ static void NextMemChannel(void)
 		gEeprom.MrChannel[    gEeprom.RX_VFO] = gNextMrChannel;
 		gEeprom.ScreenChannel[gEeprom.RX_VFO] = gNextMrChannel;
 
-		RADIO_ConfigureChannel(gEeprom.RX_VFO, VFO_CONFIGURE_RELOAD);
-		RADIO_SetupRegisters(true);
+#ifdef ENABLE_SCAN_PLAN
+		if (pRecord != NULL)
+			TuneRecord(pRecord);
+		else
+#endif
+		{
+			RADIO_ConfigureChannel(gEeprom.RX_VFO, VFO_CONFIGURE_RELOAD);
+			RADIO_SetupRegisters(true);
+		}
 
 		gUpdateDisplay = true;
 	}
 
 #ifdef ENABLE_FASTER_CHANNEL_SCAN
-	gScanPauseDelayIn_10ms = 9;  // 90ms .. <= ~60ms it misses signals (squelch response and/or PLL lock time) ?
+	gScanPauseDelayIn_10ms = SCAN_DWELL_10MS(9);  // 90ms .. <= ~60ms it misses signals (squelch response and/or PLL lock time) ?
 #else
-	gScanPauseDelayIn_10ms = scan_pause_delay_in_3_10ms;
+	gScanPauseDelayIn_10ms = SCAN_DWELL_10MS(scan_pause_delay_in_3_10ms);
 #endif
 
 	if (enabled)
@@ -14,5 +14,9 @@ void CHFRSCANNER_Found(void);
 void CHFRSCANNER_Stop(void);
 void CHFRSCANNER_Start(const bool storeBackupSettings, const int8_t scan_direction);
 void CHFRSCANNER_ContinueScanning(void);
+#ifdef ENABLE_SCAN_PLAN
+	// the scan is being dropped without CHFRSCANNER_Stop(), leaves the RX VFO fully configured
+	void CHFRSCANNER_Cancel(void);
+#endif
 
 #endif
\ No newline at end of file
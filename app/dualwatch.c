@@ -0,0 +1,55 @@
+/* Copyright 2023 Dual Tachyon
+ * https://github.com/DualTachyon
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#include "app/dualwatch.h"
+#include "misc.h"
+
+#define DUALWATCH_MAX_DWELL_10MS     40u     // a busy priority VFO
+#define DUALWATCH_OPEN_WEIGHT        256u    // activity added per squelch opening
+#define DUALWATCH_ACTIVITY_MAX       4096u
+#define DUALWATCH_ACTIVITY_FLOOR     256u    // keeps one opening from taking the whole share
+
+// decaying count of squelch openings, scaled by DUALWATCH_OPEN_WEIGHT
+static uint16_t gActivity[2];
+
+void DUALWATCH_SquelchOpened(const uint8_t Vfo)
+{
+	gActivity[Vfo] = MIN(gActivity[Vfo] + DUALWATCH_OPEN_WEIGHT, DUALWATCH_ACTIVITY_MAX);
+}
+
+void DUALWATCH_TimeSlice500ms(void)
+{	// about 11 sec half life
+	unsigned int i;
+
+	for (i = 0; i < 2; i++)
+		gActivity[i] -= (gActivity[i] + 31u) / 32u;
+}
+
+uint16_t DUALWATCH_Dwell_10ms(const uint8_t Vfo, const uint8_t PriorityVfo)
+{
+	const uint16_t Max   = (Vfo == PriorityVfo) ? DUALWATCH_MAX_DWELL_10MS : DUALWATCH_PRIORITY_REVISIT_10MS;
+	const uint32_t Total = gActivity[0] + gActivity[1] + DUALWATCH_ACTIVITY_FLOOR;
+
+	// the fixed toggle time plus this VFO's share of the recent traffic
+	return dual_watch_count_toggle_10ms + ((Max - dual_watch_count_toggle_10ms) * gActivity[Vfo]) / Total;
+}
+
+uint16_t DUALWATCH_PowerSaveSleep_10ms(const uint16_t Sleep_10ms)
+{	// the configured sleep when both VFO's are quiet, down to half of it while either is busy
+	const uint32_t Busiest = MAX(gActivity[0], gActivity[1]);
+
+	return Sleep_10ms - ((Sleep_10ms / 2u) * Busiest) / (Busiest + DUALWATCH_ACTIVITY_FLOOR);
+}
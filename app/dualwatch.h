@@ -0,0 +1,33 @@
+/* Copyright 2023 Dual Tachyon
+ * https://github.com/DualTachyon
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#ifndef APP_DUALWATCH_H
+#define APP_DUALWATCH_H
+
+#include <stdint.h>
+
+// adaptive dual watch dwell, the VFO with more squelch openings lately gets the longer listen,
+// while toggling PriorityVfo is never left for more than DUALWATCH_PRIORITY_REVISIT_10MS,
+// in power save recent traffic shortens the sleep so the next call of a run is caught sooner
+
+#define DUALWATCH_PRIORITY_REVISIT_10MS   20u   // longest dwell on the other VFO
+
+void     DUALWATCH_SquelchOpened(const uint8_t Vfo);
+void     DUALWATCH_TimeSlice500ms(void);
+uint16_t DUALWATCH_Dwell_10ms(const uint8_t Vfo, const uint8_t PriorityVfo);
+uint16_t DUALWATCH_PowerSaveSleep_10ms(const uint16_t Sleep_10ms);
+
+#endif
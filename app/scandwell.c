@@ -0,0 +1,156 @@
+/* Copyright 2023 Dual Tachyon
+ * https://github.com/DualTachyon
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+
+#include <string.h>
+
+#include "app/scandwell.h"
+#include "driver/bk4819.h"
+#ifdef ENABLE_UART
+	#include "driver/uart.h"
+	#include "external/printf/printf.h"
+#endif
+#include "radio.h"
+#include "scheduler.h"
+
+enum {
+	SCANDWELL_IDLE = 0,
+	SCANDWELL_PROBE,    // waiting to sample the indicators
+	SCANDWELL_FULL,     // the indicators were ambiguous
+	SCANDWELL_AUDIT     // looked empty, listening the full dwell to check
+};
+
+static uint8_t  gState;
+static uint16_t gRemaining_10ms;
+static uint8_t  gAuditCountdown = SCANDWELL_AUDIT_EVERY;
+
+static struct {
+	uint32_t StartUs;
+	uint16_t Channels;
+	uint16_t EarlyExits;
+	uint16_t Extended;
+	uint16_t ExtendedFound;   // signals on channels that got the full dwell
+	uint16_t Audits;
+	uint16_t AuditsFound;     // signals an early exit would have skipped
+} gStats;
+
+static bool ChannelLooksEmpty(void)
+{	// every indicator past its squelch close threshold, so the chip isn't about to open
+	if (!BK4819_WaitForLock(SCANDWELL_LOCK_TIMEOUT_US))
+		return false;   // readings not valid yet
+
+	const uint16_t Rssi   = BK4819_GetRSSI();
+	const uint8_t  Noise  = BK4819_GetExNoiceIndicator();
+	const uint8_t  Glitch = BK4819_GetGlitchIndicator();
+
+	return Rssi   <  gRxVfo->SquelchCloseRSSIThresh  &&
+	       Noise  >= gRxVfo->SquelchCloseNoiseThresh &&
+	       Glitch >= gRxVfo->SquelchCloseGlitchThresh;
+}
+
+uint16_t SCANDWELL_Begin(const uint16_t FullDwell_10ms)
+{
+	gStats.Channels++;
+
+	if (FullDwell_10ms <= SCANDWELL_PROBE_10MS)
+	{
+		gState = SCANDWELL_FULL;
+		return FullDwell_10ms;
+	}
+
+	gState          = SCANDWELL_PROBE;
+	gRemaining_10ms = FullDwell_10ms - SCANDWELL_PROBE_10MS;
+
+	return SCANDWELL_PROBE_10MS;
+}
+
+uint16_t SCANDWELL_Extend_10ms(void)
+{
+	if (gState != SCANDWELL_PROBE)
+	{
+		gState = SCANDWELL_IDLE;
+		return 0;
+	}
+
+	if (!ChannelLooksEmpty())
+	{
+		gState = SCANDWELL_FULL;
+		gStats.Extended++;
+		return gRemaining_10ms;
+	}
+
+	if (--gAuditCountdown == 0)
+	{
+		gAuditCountdown = SCANDWELL_AUDIT_EVERY;
+		gState          = SCANDWELL_AUDIT;
+		gStats.Audits++;
+		return gRemaining_10ms;
+	}
+
+	gState = SCANDWELL_IDLE;
+	gStats.EarlyExits++;
+
+	return 0;
+}
+
+void SCANDWELL_SignalFound(void)
+{
+	if (gState == SCANDWELL_FULL)
+		gStats.ExtendedFound++;
+	else
+	if (gState == SCANDWELL_AUDIT)
+		gStats.AuditsFound++;
+
+	gState = SCANDWELL_IDLE;
+}
+
+void SCANDWELL_ResetStats(void)
+{
+	memset(&gStats, 0, sizeof(gStats));
+	gStats.StartUs = SCHEDULER_GetUptimeUs();
+	gState         = SCANDWELL_IDLE;
+}
+
+#ifdef ENABLE_UART
+	void SCANDWELL_SendStats(void)
+	{
+		char           String[64];
+		const uint32_t Elapsed_ms = (SCHEDULER_GetUptimeUs() - gStats.StartUs) / 1000u;
+		// tenths of a channel per second, and tenths of a percent of the audited exits
+		const uint32_t Rate       = Elapsed_ms ? (gStats.Channels * 10000u) / Elapsed_ms : 0;
+		const uint32_t FalseSkip  = gStats.Audits ? (gStats.AuditsFound * 1000u) / gStats.Audits : 0;
+
+		sprintf(String, "scan %u ch %lu.%lu ch/s\r\n",
+			gStats.Channels, (unsigned long)(Rate / 10), (unsigned long)(Rate % 10));
+		UART_Send(String, strlen(String));
+
+		sprintf(String, "scan early %u ext %u/%u found\r\n",
+			gStats.EarlyExits, gStats.Extended, gStats.ExtendedFound);
+		UART_Send(String, strlen(String));
+
+		sprintf(String, "scan audit %u/%u false skip %lu.%lu%%\r\n",
+			gStats.AuditsFound, gStats.Audits, (unsigned long)(FalseSkip / 10), (unsigned long)(FalseSkip % 10));
+		UART_Send(String, strlen(String));
+
+		{	// since power up, the last bin is the timeouts
+			const uint16_t *pLock = BK4819_GetLockHistogram();
+
+			sprintf(String, "lock %u %u %u %u %u %u %u %u\r\n",
+				pLock[0], pLock[1], pLock[2], pLock[3], pLock[4], pLock[5], pLock[6], pLock[7]);
+			UART_Send(String, strlen(String));
+		}
+	}
+#endif
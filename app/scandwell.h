@@ -0,0 +1,44 @@
+/* Copyright 2023 Dual Tachyon
+ * https://github.com/DualTachyon
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+
+#ifndef APP_SCANDWELL_H
+#define APP_SCANDWELL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// adaptive scan dwell, a freshly tuned channel is looked at after SCANDWELL_PROBE_10MS and left right
+// away if RSSI, noise and glitch all say it's empty, otherwise it gets the full dwell
+
+#define SCANDWELL_PROBE_10MS        3u      // PLL locked and the indicators settled
+#define SCANDWELL_AUDIT_EVERY       16u     // every so many early exits get the full dwell anyway
+#define SCANDWELL_LOCK_TIMEOUT_US   1000u   // longest the probe waits for valid readings
+
+// a new channel is tuned, returns the 10ms ticks to wait before SCANDWELL_Extend_10ms()
+uint16_t SCANDWELL_Begin(const uint16_t FullDwell_10ms);
+// the wait is over and the squelch is still shut, returns the ticks to keep listening or 0 to move on
+uint16_t SCANDWELL_Extend_10ms(void);
+// the squelch opened on the channel being dwelt on
+void     SCANDWELL_SignalFound(void);
+
+void     SCANDWELL_ResetStats(void);
+#ifdef ENABLE_UART
+	// channels/s, early exits and the false skip estimate from the audited exits
+	void SCANDWELL_SendStats(void);
+#endif
+
+#endif
@@ -364,6 +364,11 @@ void SCANNER_Start(bool singleFreq)
 	g_SquelchLost          = false;
 	gScannerSaveState      = SCAN_SAVE_NO_PROMPT;
 	gScanProgressIndicator = 0;
+
+#ifdef ENABLE_BK4819_IRQ_QUEUE
+	// the systick poll stops while the scanner runs, don't leave events for after it
+	BK4819_FlushInterrupts();
+#endif
 }
 
 void SCANNER_Stop(void)
@@ -379,6 +384,10 @@ void SCANNER_Stop(void)
 		gAnotherVoiceID          = VOICE_ID_CANCEL;
 #endif
 		BK4819_StopScan();
+
+#ifdef ENABLE_BK4819_IRQ_QUEUE
+		BK4819_FlushInterrupts();
+#endif
 	}
 }
 
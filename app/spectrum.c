@@ -26,6 +26,8 @@ struct FrequencyBandInfo {
 
 #define F_MIN frequencyBandTable[0].lower
 #define F_MAX frequencyBandTable[ARRAY_SIZE(frequencyBandTable) - 1].upper
+// longest a sweep step waits for the glitch indicator to settle after SetF
+#define SPECTRUM_LOCK_TIMEOUT_US 5000
 
 const uint16_t RSSI_MAX_VALUE = 65535;
 
@@ -49,6 +51,9 @@ ScanInfo scanInfo;
 KeyboardState kbd = {KEY_INVALID, KEY_INVALID, 0};
 
 const char *bwOptions[] = {"  25k", "12.5k", "6.25k"};
+#ifdef ENABLE_SPECTRUM_TRACES
+const char *traceOptions[] = {"", "AVG", "PEAK", "MIN"};
+#endif
 const uint8_t modulationTypeTuneSteps[] = {100, 50, 10};
 const uint8_t modTypeReg47Values[] = {1, 7, 5};
 
@@ -68,6 +73,40 @@ uint32_t fMeasure = 0;
 uint32_t currentFreq, tempFreq;
 uint16_t rssiHistory[128];
 
+#ifdef ENABLE_SPECTRUM_TRACES
+// peak hold drops 1dB every so many sweeps
+#define PEAK_DECAY_SWEEPS 8
+
+TraceMode traceMode = TRACE_LIVE;
+TraceBin traces[128];
+uint8_t traceSweeps = 0;
+#endif
+
+#ifdef ENABLE_SPECTRUM_MULTIPASS
+// the wide filter is about 25kHz, a coarse measurement can't cover more than that
+#define COARSE_SPAN 2500
+#define COARSE_MAX_BINS 8
+// groups this close under the trigger level get the fine pass too
+#define REFINE_MARGIN 10
+
+// coarse pass: one wide filter measurement per group of bins, then the fine
+// pass measures only the bins of the groups that came up
+uint8_t groupBins = 1;
+bool finePass = false;
+uint64_t groupsToRefine = 0;
+#endif
+
+#ifdef ENABLE_SPECTRUM_WATERFALL
+bool waterfallMode = false;
+bool waterfallRowPending = false;
+uint8_t waterfallStartLine = 0;
+
+// 4x4 ordered dither, turns the signal level into shades of grey
+static const uint8_t waterfallDither[16] = {
+    0, 8, 2, 10, 12, 4, 14, 6, 3, 11, 1, 9, 15, 7, 13, 5,
+};
+#endif
+
 uint8_t freqInputIndex = 0;
 uint8_t freqInputDotIndex = 0;
 KEY_Code_t freqInputArr[10];
@@ -188,6 +227,10 @@ static int clamp(int v, int min, int max) {
 static uint8_t my_abs(signed v) { return v > 0 ? v : -v; }
 
 void SetState(State state) {
+#ifdef ENABLE_SPECTRUM_WATERFALL
+  // the full redraw below also takes the display out of the hardware scroll
+  waterfallMode = false;
+#endif
   previousState = currentState;
   currentState = state;
   redrawScreen = true;
@@ -279,10 +322,8 @@ uint8_t GetBWRegValueForScan() {
 
 uint16_t GetRssi() {
   // SYSTICK_DelayUs(800);
-  // testing autodelay based on Glitch value
-  while ((BK4819_ReadRegister(0x63) & 0b11111111) >= 255) {
-    SYSTICK_DelayUs(100);
-  }
+  // wait for the glitch indicator to settle, a stuck one no longer hangs the sweep
+  BK4819_WaitForLock(SPECTRUM_LOCK_TIMEOUT_US);
   return BK4819_GetRSSI();
 }
 
@@ -324,6 +365,16 @@ static void ResetScanStats() {
   scanInfo.fPeak = 0;
 }
 
+#ifdef ENABLE_SPECTRUM_MULTIPASS
+static uint8_t GetGroupBins() {
+  uint8_t n = 1;
+  while (n < COARSE_MAX_BINS && GetScanStep() * (n << 1) <= COARSE_SPAN) {
+    n <<= 1;
+  }
+  return n;
+}
+#endif
+
 static void InitScan() {
   ResetScanStats();
   scanInfo.i = 0;
@@ -331,6 +382,11 @@ static void InitScan() {
 
   scanInfo.scanStep = GetScanStep();
   scanInfo.measurementsCount = GetStepsCount();
+#ifdef ENABLE_SPECTRUM_MULTIPASS
+  groupBins = GetGroupBins();
+  finePass = false;
+  groupsToRefine = 0;
+#endif
 }
 
 static void ResetBlacklist() {
@@ -340,9 +396,62 @@ static void ResetBlacklist() {
   }
 }
 
+#ifdef ENABLE_SPECTRUM_TRACES
+static void ResetTraces() {
+  for (int i = 0; i < 128; ++i) {
+    traces[i].average = 0;
+    traces[i].peak = 0;
+    traces[i].min = 255;
+  }
+}
+
+static void UpdateTrace(uint8_t i, uint16_t rssi) {
+  if (i >= ARRAY_SIZE(traces)) {
+    return;
+  }
+
+  TraceBin *t = &traces[i];
+  const uint8_t v = rssi > 511 ? 255 : rssi >> 1;
+
+  if (t->min == 255) {
+    t->average = v;
+  } else {
+    // 1/4 of the way there, but at least 1dB so it doesn't stall short of v
+    const int d = v - t->average;
+    t->average += d > 0 ? (d + 3) / 4 : (d - 3) / 4;
+  }
+
+  if (traceSweeps == 0 && t->peak > 0) {
+    t->peak--;
+  }
+  if (v > t->peak) {
+    t->peak = v;
+  }
+  if (v < t->min) {
+    t->min = v;
+  }
+}
+
+static uint16_t TraceRssi(uint8_t i) {
+  switch (traceMode) {
+  case TRACE_AVERAGE:
+    return traces[i].average << 1;
+  case TRACE_PEAK_HOLD:
+    return traces[i].peak << 1;
+  case TRACE_MIN_HOLD:
+    return traces[i].min == 255 ? 0 : traces[i].min << 1;
+  default:
+    return rssiHistory[i];
+  }
+}
+#endif
+
 static void RelaunchScan() {
   InitScan();
   ResetPeak();
+#ifdef ENABLE_SPECTRUM_TRACES
+  ResetTraces();
+#endif
   ToggleRX(false);
 #ifdef SPECTRUM_AUTOMATIC_SQUELCH
   settings.rssiTriggerLevel = RSSI_MAX_VALUE;
@@ -384,7 +493,12 @@ static void UpdatePeakInfo() {
     UpdatePeakInfoForce();
 }
 
-static void Measure() { rssiHistory[scanInfo.i] = scanInfo.rssi = GetRssi(); }
+static void Measure() {
+  rssiHistory[scanInfo.i] = scanInfo.rssi = GetRssi();
+#ifdef ENABLE_SPECTRUM_TRACES
+  UpdateTrace(scanInfo.i, scanInfo.rssi);
+#endif
+}
 
 // Update things by keypress
 
@@ -603,13 +717,87 @@ uint8_t Rssi2Y(uint16_t rssi) {
 }
 
 static void DrawSpectrum() {
-  for (uint8_t x = 0; x < 128; ++x) {
+  const uint8_t binWidth = 1 << settings.stepsCount;
+  for (uint8_t x = 0; x < 128; x += binWidth) {
     uint16_t rssi = rssiHistory[x >> settings.stepsCount];
-    if (rssi != RSSI_MAX_VALUE) {
-      DrawHLine(Rssi2Y(rssi), DrawingEndY, x, true);
+    if (rssi == RSSI_MAX_VALUE) {
+      continue;
+    }
+#ifdef ENABLE_SPECTRUM_TRACES
+    rssi = TraceRssi(x >> settings.stepsCount);
+#endif
+    // one Rssi2Y per scan step, not per column
+    uint8_t y = Rssi2Y(rssi);
+    for (uint8_t i = 0; i < binWidth; ++i) {
+      DrawHLine(y, DrawingEndY, x + i, true);
+    }
+  }
+}
+
+#ifdef ENABLE_SPECTRUM_WATERFALL
+static void ToggleWaterfall() {
+  waterfallMode = !waterfallMode;
+  waterfallRowPending = false;
+  waterfallStartLine = 0;
+  if (waterfallMode) {
+    // the waterfall takes the whole display, status line included
+    memset(gStatusLine, 0, sizeof(gStatusLine));
+    memset(gFrameBuffer, 0, sizeof(gFrameBuffer));
+    ST7565_FillScreen(0x00);
+  }
+  redrawStatus = true;
+  redrawScreen = true;
+}
+
+static void DrawWaterfallRow() {
+  // the new row goes just above the top of the screen and the display start
+  // line moves up onto it, so the older rows scroll down without being resent
+  waterfallStartLine = (waterfallStartLine - 1) & 63;
+
+  const uint8_t page = waterfallStartLine >> 3;
+  const uint8_t mask = 1 << (waterfallStartLine & 7);
+  const uint8_t *dither = &waterfallDither[(waterfallStartLine & 3) << 2];
+  uint8_t *line = page ? gFrameBuffer[page - 1] : gStatusLine;
+  uint8_t level = 0;
+
+  for (uint8_t x = 0; x < 128; ++x) {
+    if ((x & ((1 << settings.stepsCount) - 1)) == 0) {
+      uint16_t rssi = rssiHistory[x >> settings.stepsCount];
+      level = rssi == RSSI_MAX_VALUE ? 0 : Rssi2PX(rssi, 0, 16);
     }
+    if (level > dither[x & 3]) {
+      line[x] |= mask;
+    } else {
+      line[x] &= ~mask;
+    }
+  }
+
+  ST7565_DrawLine(0, page, 128, line);
+  ST7565_SetStartLine(waterfallStartLine);
+}
+#endif
+
+#ifdef ENABLE_SPECTRUM_TRACES
+// live, average, peak hold, min hold, then the waterfall if there is one
+static void CycleTraceMode() {
+#ifdef ENABLE_SPECTRUM_WATERFALL
+  if (waterfallMode) {
+    ToggleWaterfall();
+    traceMode = TRACE_LIVE;
+    return;
   }
+#endif
+  if (traceMode == TRACE_MIN_HOLD) {
+    traceMode = TRACE_LIVE;
+#ifdef ENABLE_SPECTRUM_WATERFALL
+    ToggleWaterfall();
+#endif
+  } else {
+    traceMode++;
+  }
+  redrawScreen = true;
 }
+#endif
 
 static void DrawStatus() {
 #ifdef SPECTRUM_EXTRA_VALUES
@@ -669,6 +857,11 @@ static void DrawNums() {
     GUI_DisplaySmallest(String, 0, 1, false, true);
     sprintf(String, "%u.%02uk", GetScanStep() / 100, GetScanStep() % 100);
     GUI_DisplaySmallest(String, 0, 7, false, true);
+#ifdef ENABLE_SPECTRUM_TRACES
+    if (traceMode != TRACE_LIVE) {
+      GUI_DisplaySmallest(traceOptions[traceMode], 0, 13, false, true);
+    }
+#endif
   }
 
   if (IsCenterMode()) {
@@ -793,6 +986,11 @@ static void OnKeyDown(uint8_t key) {
     TuneToPeak();
     break;
   case KEY_MENU:
+#ifdef ENABLE_SPECTRUM_TRACES
+    CycleTraceMode();
+#elif defined(ENABLE_SPECTRUM_WATERFALL)
+    ToggleWaterfall();
+#endif
     break;
   case KEY_EXIT:
     if (menuState) {
@@ -921,6 +1119,11 @@ static void RenderFreqInput() {
 }
 
 static void RenderStatus() {
+#ifdef ENABLE_SPECTRUM_WATERFALL
+  if (waterfallMode) {
+    return;
+  }
+#endif
   memset(gStatusLine, 0, sizeof(gStatusLine));
   DrawStatus();
   ST7565_BlitStatusLine();
@@ -996,6 +1199,17 @@ static void RenderStill() {
 }
 
 static void Render() {
+#ifdef ENABLE_SPECTRUM_WATERFALL
+  if (waterfallMode) {
+    // only one display line goes out per sweep
+    if (waterfallRowPending) {
+      DrawWaterfallRow();
+      waterfallRowPending = false;
+    }
+    return;
+  }
+#endif
+
   memset(gFrameBuffer, 0, sizeof(gFrameBuffer));
 
   switch (currentState) {
@@ -1058,16 +1272,121 @@ static void NextScanStep() {
   scanInfo.f += scanInfo.scanStep;
 }
 
-static void UpdateScan() {
-  Scan();
+#ifdef ENABLE_SPECTRUM_MULTIPASS
+static void ScanGroup() {
+  const uint8_t end = scanInfo.i + groupBins;
+  bool blacklisted = true;
 
-  if (scanInfo.i < scanInfo.measurementsCount) {
-    NextScanStep();
+  for (uint8_t i = scanInfo.i; i < end; ++i) {
+    blacklisted &= rssiHistory[i] == RSSI_MAX_VALUE;
+  }
+  if (blacklisted) {
     return;
   }
 
+  // middle of the group
+  SetF(scanInfo.f + scanInfo.scanStep * (groupBins - 1) / 2);
+  scanInfo.rssi = GetRssi();
+  UpdateScanInfo();
+
+  for (uint8_t i = scanInfo.i; i < end; ++i) {
+    if (rssiHistory[i] != RSSI_MAX_VALUE) {
+      rssiHistory[i] = scanInfo.rssi;
+    }
+  }
+
+  if (settings.rssiTriggerLevel != RSSI_MAX_VALUE &&
+      scanInfo.rssi + REFINE_MARGIN >= settings.rssiTriggerLevel) {
+    groupsToRefine |= 1ULL << (scanInfo.i / groupBins);
+  }
+}
+
+#ifdef ENABLE_SPECTRUM_TRACES
+// once per sweep for every bin: the groups left out of the fine pass go in
+// with their coarse reading, the refined ones with the fine one in Measure()
+static void UpdateCoarseTraces() {
+  for (uint8_t i = 0; i < scanInfo.measurementsCount; ++i) {
+    if (rssiHistory[i] != RSSI_MAX_VALUE &&
+        !((groupsToRefine >> (i / groupBins)) & 1)) {
+      UpdateTrace(i, rssiHistory[i]);
+    }
+  }
+}
+#endif
+
+// moves to the next bin of a group to refine, false when there are none left
+static bool SeekRefineBin() {
+  while (scanInfo.i < scanInfo.measurementsCount &&
+         !((groupsToRefine >> (scanInfo.i / groupBins)) & 1)) {
+    ++scanInfo.i;
+  }
+  scanInfo.f = GetFStart() + scanInfo.i * scanInfo.scanStep;
+  return scanInfo.i < scanInfo.measurementsCount;
+}
+
+// one measurement of the sweep, false when it's complete
+static bool MultiPassStep() {
+  if (finePass) {
+    Scan();
+    ++peak.t;
+    ++scanInfo.i;
+    return SeekRefineBin();
+  }
+
+  if (scanInfo.i == 0) {
+    BK4819_WriteRegister(BK4819_REG_43, listenBWRegValues[BK4819_FILTER_BW_WIDE]);
+  }
+
+  ScanGroup();
+  ++peak.t;
+  scanInfo.i += groupBins;
+  scanInfo.f += scanInfo.scanStep * groupBins;
+  if (scanInfo.i < scanInfo.measurementsCount) {
+    return true;
+  }
+
+  // the strongest group always gets refined, so the peak keeps the full resolution
+  groupsToRefine |= 1ULL << (scanInfo.iPeak / groupBins);
+#ifdef ENABLE_SPECTRUM_TRACES
+  UpdateCoarseTraces();
+#endif
+  finePass = true;
+  // the wide filter reads higher, the peak comes from the fine readings
+  scanInfo.rssiMax = 0;
+  BK4819_WriteRegister(BK4819_REG_43, GetBWRegValueForScan());
+
+  scanInfo.i = 0;
+  return SeekRefineBin();
+}
+#endif
+
+static void UpdateScan() {
+#ifdef ENABLE_SPECTRUM_MULTIPASS
+  if (groupBins > 1) {
+    if (MultiPassStep()) {
+      return;
+    }
+  } else
+#endif
+  {
+    Scan();
+
+    if (scanInfo.i < scanInfo.measurementsCount) {
+      NextScanStep();
+      return;
+    }
+  }
+
   redrawScreen = true;
   preventKeypress = false;
+#ifdef ENABLE_SPECTRUM_WATERFALL
+  waterfallRowPending = true;
+#endif
+#ifdef ENABLE_SPECTRUM_TRACES
+  if (++traceSweeps >= PEAK_DECAY_SWEEPS) {
+    traceSweeps = 0;
+  }
+#endif
 
   UpdatePeakInfo();
   if (IsPeakOverLevel()) {
@@ -1157,6 +1476,9 @@ void APP_RunSpectrum() {
   BackupRegisters();
 
   isListening = true; // to turn off RX later
+#ifdef ENABLE_SPECTRUM_WATERFALL
+  waterfallMode = false;
+#endif
   redrawStatus = true;
   redrawScreen = false; // we will wait until scan done
   newScanStart = true;
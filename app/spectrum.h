@@ -143,6 +143,22 @@ typedef struct ScanInfo {
   uint8_t measurementsCount;
 } ScanInfo;
 
+#ifdef ENABLE_SPECTRUM_TRACES
+typedef enum TraceMode {
+  TRACE_LIVE,
+  TRACE_AVERAGE,
+  TRACE_PEAK_HOLD,
+  TRACE_MIN_HOLD,
+} TraceMode;
+
+// per bin, in dB above -160dBm (rssi / 2)
+typedef struct TraceBin {
+  uint8_t average;
+  uint8_t peak;
+  uint8_t min; // 255 until the bin is first measured
+} TraceBin;
+#endif
+
 typedef struct PeakInfo {
   uint16_t t;
   uint16_t rssi;
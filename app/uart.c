@@ -32,6 +32,9 @@
 #include "driver/crc.h"
 #include "driver/eeprom.h"
 #include "driver/gpio.h"
+#ifdef ENABLE_UART_SCREENSHOT
+	#include "driver/st7565.h"
+#endif
 #include "driver/uart.h"
 #include "functions.h"
 #include "misc.h"
@@ -120,6 +123,19 @@ typedef struct {
 	} Data;
 } REPLY_0529_t;
 
+#ifdef ENABLE_UART_SCREENSHOT
+	typedef struct {
+		Header_t Header;
+		struct {
+			uint8_t  Line;          // 0 = status line, 1..7 = frame buffer lines
+			uint8_t  Padding[3];
+			uint32_t BlitCount;
+			uint32_t ByteCount;
+			uint8_t  Data[128];     // one byte per column, LSB is the top pixel
+		} Data;
+	} REPLY_0532_t;
+#endif
+
 typedef struct {
 	Header_t Header;
 	uint32_t Response[4];
@@ -310,11 +326,22 @@ static void CMD_051D(const uint8_t *pBuffer)
 					bReloadEeprom = true;
 
 			if ((Offset < 0x0E98 || Offset >= 0x0EA0) || !bIsInLockScreen || pCmd->bAllowPassword)
+			{
 				EEPROM_WriteBuffer(Offset, &pCmd->Data[i * 8U]);
+
+				#ifdef ENABLE_CHANNEL_TABLE
+					BOARD_UpdateChannelTable(Offset, &pCmd->Data[i * 8U]);
+				#endif
+			}
 		}
 
 		if (bReloadEeprom)
+		{
 			BOARD_EEPROM_Init();
+			#if defined(ENABLE_STAGED_BOOT) && defined(ENABLE_FMRADIO)
+				BOARD_EEPROM_LoadFMChannels();   // BOARD_EEPROM_Init() leaves them to the boot
+			#endif
+		}
 	}
 
 	SendReply(&Reply, sizeof(Reply));
@@ -346,6 +373,29 @@ static void CMD_0529(void)
 	SendReply(&Reply, sizeof(Reply));
 }
 
+#ifdef ENABLE_UART_SCREENSHOT
+	static void CMD_0531(void)
+	{	// dump what the firmware has drawn, one reply per LCD page
+		REPLY_0532_t Reply;
+		unsigned int Line;
+
+		for (Line = 0; Line < 8; Line++)
+		{
+			Reply.Header.ID   = 0x0532;
+			Reply.Header.Size = sizeof(Reply.Data);
+
+			Reply.Data.Line      = Line;
+			memset(Reply.Data.Padding, 0, sizeof(Reply.Data.Padding));
+			Reply.Data.BlitCount = gST7565_BlitCount;
+			Reply.Data.ByteCount = gST7565_ByteCount;
+			memcpy(Reply.Data.Data, (Line == 0) ? gStatusLine : gFrameBuffer[Line - 1], sizeof(Reply.Data.Data));
+
+			// SendReply() obfuscates the buffer in place, so it's rebuilt for each line
+			SendReply(&Reply, sizeof(Reply));
+		}
+	}
+#endif
+
 static void CMD_052D(const uint8_t *pBuffer)
 {
 	const CMD_052D_t *pCmd = (const CMD_052D_t *)pBuffer;
@@ -419,6 +469,18 @@ static void CMD_052F(const uint8_t *pBuffer)
 	SendVersion();
 }
 
+static uint16_t RingCrc(const uint16_t Index, const uint16_t Size)
+{	// CRC of Size bytes of the DMA ring buffer from Index on, in at most two pieces
+	const uint16_t ChunkSize = MIN(Size, (uint16_t)(sizeof(UART_DMA_Buffer) - Index));
+	CRC_Context_t  Context;
+
+	CRC_Begin(&Context);
+	CRC_Update(&Context, UART_DMA_Buffer + Index, ChunkSize);
+	CRC_Update(&Context, UART_DMA_Buffer, Size - ChunkSize);
+
+	return CRC_End(&Context);
+}
+
 bool UART_IsCommandAvailable(void)
 {
 	uint16_t Index;
@@ -426,6 +488,9 @@ bool UART_IsCommandAvailable(void)
 	uint16_t Size;
 	uint16_t CRC;
 	uint16_t CommandLength;
+	uint16_t ID;
+	bool     bCrcOk    = true;
+	unsigned int i;
 	uint16_t DmaLength = DMA_CH0->ST & 0xFFFU;
 
 	while (1)
@@ -474,14 +539,33 @@ bool UART_IsCommandAvailable(void)
 		return false;
 	}
 
-	if (TailIndex < Index)
+	ID = UART_DMA_Buffer[Index] | (UART_DMA_Buffer[DMA_INDEX(Index, 1)] << 8);
+
+	if (ID == 0x0514)
+		bIsEncrypted = false;
+
+	if (ID == 0x6902)
+		bIsEncrypted = true;
+
+	if (!bIsEncrypted)
+	{	// plain frames are checked where the DMA left them, a bad one isn't copied out at all
+		const uint16_t CrcIndex = DMA_INDEX(Index, Size);
+
+		CRC = UART_DMA_Buffer[CrcIndex] | (UART_DMA_Buffer[DMA_INDEX(CrcIndex, 1)] << 8);
+		bCrcOk = (RingCrc(Index, Size) == CRC);
+	}
+
+	if (bCrcOk)
 	{
-		const uint16_t ChunkSize = sizeof(UART_DMA_Buffer) - Index;
-		memmove(UART_Command.Buffer, UART_DMA_Buffer + Index, ChunkSize);
-		memmove(UART_Command.Buffer + ChunkSize, UART_DMA_Buffer, TailIndex);
+		if (TailIndex < Index)
+		{
+			const uint16_t ChunkSize = sizeof(UART_DMA_Buffer) - Index;
+			memmove(UART_Command.Buffer, UART_DMA_Buffer + Index, ChunkSize);
+			memmove(UART_Command.Buffer + ChunkSize, UART_DMA_Buffer, TailIndex);
+		}
+		else
+			memmove(UART_Command.Buffer, UART_DMA_Buffer + Index, TailIndex - Index);
 	}
-	else
-		memmove(UART_Command.Buffer, UART_DMA_Buffer + Index, TailIndex - Index);
 
 	TailIndex = DMA_INDEX(TailIndex, 2);
 	if (TailIndex < gUART_WriteIndex)
@@ -494,18 +578,12 @@ bool UART_IsCommandAvailable(void)
 
 	gUART_WriteIndex = TailIndex;
 
-	if (UART_Command.Header.ID == 0x0514)
-		bIsEncrypted = false;
+	if (!bIsEncrypted)
+		return bCrcOk;
 
-	if (UART_Command.Header.ID == 0x6902)
-		bIsEncrypted = true;
-
-	if (bIsEncrypted)
-	{
-		unsigned int i;
-		for (i = 0; i < (Size + 2u); i++)
-			UART_Command.Buffer[i] ^= Obfuscation[i % 16];
-	}
+	// obfuscated frames have to be unscrambled before the CRC means anything
+	for (i = 0; i < (Size + 2u); i++)
+		UART_Command.Buffer[i] ^= Obfuscation[i % 16];
 	
 	CRC = UART_Command.Buffer[Size] | (UART_Command.Buffer[Size + 1] << 8);
 
@@ -549,8 +627,17 @@ void UART_HandleCommand(void)
 		case 0x052F:
 			CMD_052F(UART_Command.Buffer);
 			break;
+
+		#ifdef ENABLE_UART_SCREENSHOT
+			case 0x0531:
+				CMD_0531();
+				break;
+		#endif
 	
 		case 0x05DD:
+			#ifdef ENABLE_EEPROM_WRITE_BEHIND
+				EEPROM_Flush();
+			#endif
 			#if defined(ENABLE_OVERLAY)
 				overlay_FLASH_RebootToBootloader();
 			#else
@@ -28,6 +28,9 @@
 #include "driver/systick.h"
 #include "functions.h"
 #include "misc.h"
+#ifdef ENABLE_TASK_SCHEDULER
+	#include "scheduler.h"
+#endif
 #include "settings.h"
 #include "ui/ui.h"
 
@@ -62,9 +65,15 @@
 	VOICE_ID_t        gVoiceID[8];
 	uint8_t           gVoiceReadIndex;
 	uint8_t           gVoiceWriteIndex;
-	volatile uint16_t gCountdownToPlayNextVoice_10ms;
+	#ifndef ENABLE_TASK_SCHEDULER
+		volatile uint16_t gCountdownToPlayNextVoice_10ms;
+	#endif
 	volatile bool     gFlagPlayQueuedVoice;
 	VOICE_ID_t        gAnotherVoiceID = VOICE_ID_INVALID;
+
+	#ifdef ENABLE_TASK_SCHEDULER
+		static SCHEDULER_Task_t gPlayQueuedVoiceTask = SCHEDULER_TASK(AUDIO_PlayQueuedVoice, SCHEDULER_PRIORITY_NORMAL);
+	#endif
 	
 #endif
 
@@ -310,8 +319,12 @@ void AUDIO_PlayBeep(BEEP_Type_t Beep)
 			}
 	
 			gVoiceReadIndex                = 1;
-			gCountdownToPlayNextVoice_10ms = Delay;
-			gFlagPlayQueuedVoice           = false;
+			#ifdef ENABLE_TASK_SCHEDULER
+				SCHEDULER_Start(&gPlayQueuedVoiceTask, Delay, 0);
+			#else
+				gCountdownToPlayNextVoice_10ms = Delay;
+				gFlagPlayQueuedVoice           = false;
+			#endif
 	
 			return;
 		}
@@ -416,8 +429,12 @@ void AUDIO_PlayBeep(BEEP_Type_t Beep)
 	
 				AUDIO_PlayVoice(VoiceID);
 				
-				gCountdownToPlayNextVoice_10ms = Delay;
-				gFlagPlayQueuedVoice           = false;
+				#ifdef ENABLE_TASK_SCHEDULER
+					SCHEDULER_Start(&gPlayQueuedVoiceTask, Delay, 0);
+				#else
+					gCountdownToPlayNextVoice_10ms = Delay;
+					gFlagPlayQueuedVoice           = false;
+				#endif
 
 				#ifdef ENABLE_VOX
 					gVoxResumeCountdown = 2000;
@@ -145,7 +145,9 @@ static inline void AUDIO_AudioPathOff(void) {
 	extern VOICE_ID_t        gVoiceID[8];
 	extern uint8_t           gVoiceReadIndex;
 	extern uint8_t           gVoiceWriteIndex;
-	extern volatile uint16_t gCountdownToPlayNextVoice_10ms;
+	#ifndef ENABLE_TASK_SCHEDULER
+		extern volatile uint16_t gCountdownToPlayNextVoice_10ms;
+	#endif
 	extern volatile bool     gFlagPlayQueuedVoice;
 	extern VOICE_ID_t        gAnotherVoiceID;
 	
@@ -583,9 +583,9 @@ void BOARD_EEPROM_Init(void)
 		gEeprom.FM_IsMrMode        = (FM.IsMrMode < 2) ? FM.IsMrMode : false;
 	}
 
-	// 0E40..0E67
-	EEPROM_ReadBuffer(0x0E40, gFM_Channels, sizeof(gFM_Channels));
-	FM_ConfigureChannelState();
+	#ifndef ENABLE_STAGED_BOOT
+		BOARD_EEPROM_LoadFMChannels();   // otherwise left to the main loop
+	#endif
 #endif
 
 	// 0E90..0E97
@@ -728,6 +728,10 @@ void BOARD_EEPROM_Init(void)
 	// 0D60..0E27
 	EEPROM_ReadBuffer(0x0D60, gMR_ChannelAttributes, sizeof(gMR_ChannelAttributes));
 
+	#if defined(ENABLE_CHANNEL_TABLE) && !defined(ENABLE_STAGED_BOOT)
+		BOARD_EEPROM_LoadChannelTable(ARRAY_SIZE(gChannelTable));
+	#endif
+
 	// 0F30..0F3F
 	EEPROM_ReadBuffer(0x0F30, gCustomAesKey, sizeof(gCustomAesKey));
 	bHasCustomAesKey = false;
@@ -741,20 +745,35 @@ void BOARD_EEPROM_Init(void)
 	}
 }
 
+#ifdef ENABLE_FMRADIO
+	void BOARD_EEPROM_LoadFMChannels(void)
+	{
+		// 0E40..0E67
+		EEPROM_ReadBuffer(0x0E40, gFM_Channels, sizeof(gFM_Channels));
+		FM_ConfigureChannelState();
+	}
+#endif
+
 void BOARD_EEPROM_LoadCalibration(void)
 {
 //	uint8_t Mic;
 
-	EEPROM_ReadBuffer(0x1EC0, gEEPROM_RSSI_CALIB[3], 8);
+	// 1EC0..1F8F in one read
+	uint8_t Calibration[0x1F90 - 0x1EC0];
+	#define CALIBRATION(Address)   &Calibration[(Address) - 0x1EC0]
+
+	EEPROM_ReadRegion(0x1EC0, Calibration, sizeof(Calibration));
+
+	memcpy(gEEPROM_RSSI_CALIB[3], CALIBRATION(0x1EC0), 8);
 	memcpy(gEEPROM_RSSI_CALIB[4], gEEPROM_RSSI_CALIB[3], 8);
 	memcpy(gEEPROM_RSSI_CALIB[5], gEEPROM_RSSI_CALIB[3], 8);
 	memcpy(gEEPROM_RSSI_CALIB[6], gEEPROM_RSSI_CALIB[3], 8);
 
-	EEPROM_ReadBuffer(0x1EC8, gEEPROM_RSSI_CALIB[0], 8);
+	memcpy(gEEPROM_RSSI_CALIB[0], CALIBRATION(0x1EC8), 8);
 	memcpy(gEEPROM_RSSI_CALIB[1], gEEPROM_RSSI_CALIB[0], 8);
 	memcpy(gEEPROM_RSSI_CALIB[2], gEEPROM_RSSI_CALIB[0], 8);
 
-	EEPROM_ReadBuffer(0x1F40, gBatteryCalibration, 12);
+	memcpy(gBatteryCalibration, CALIBRATION(0x1F40), 12);
 	if (gBatteryCalibration[0] >= 5000)
 	{
 		gBatteryCalibration[0] = 1900;
@@ -763,8 +782,8 @@ void BOARD_EEPROM_LoadCalibration(void)
 	gBatteryCalibration[5] = 2300;
 
 	#ifdef ENABLE_VOX
-		EEPROM_ReadBuffer(0x1F50 + (gEeprom.VOX_LEVEL * 2), &gEeprom.VOX1_THRESHOLD, 2);
-		EEPROM_ReadBuffer(0x1F68 + (gEeprom.VOX_LEVEL * 2), &gEeprom.VOX0_THRESHOLD, 2);
+		memcpy(&gEeprom.VOX1_THRESHOLD, CALIBRATION(0x1F50 + (gEeprom.VOX_LEVEL * 2)), 2);
+		memcpy(&gEeprom.VOX0_THRESHOLD, CALIBRATION(0x1F68 + (gEeprom.VOX_LEVEL * 2)), 2);
 	#endif
 	
 	//EEPROM_ReadBuffer(0x1F80 + gEeprom.MIC_SENSITIVITY, &Mic, 1);
@@ -783,7 +802,7 @@ void BOARD_EEPROM_LoadCalibration(void)
 
 		// radio 1 .. 04 00 46 00 50 00 2C 0E
 		// radio 2 .. 05 00 46 00 50 00 2C 0E
-		EEPROM_ReadBuffer(0x1F88, &Misc, 8);
+		memcpy(&Misc, CALIBRATION(0x1F88), 8);
 
 		gEeprom.BK4819_XTAL_FREQ_LOW = (Misc.BK4819_XtalFreqLow >= -1000 && Misc.BK4819_XtalFreqLow <= 1000) ? Misc.BK4819_XtalFreqLow : 0;
 		gEEPROM_1F8A                 = Misc.EEPROM_1F8A & 0x01FF;
@@ -794,8 +813,41 @@ void BOARD_EEPROM_LoadCalibration(void)
 		BK4819_WriteRegister(BK4819_REG_3B, 22656 + gEeprom.BK4819_XTAL_FREQ_LOW);
 //		BK4819_WriteRegister(BK4819_REG_3C, gEeprom.BK4819_XTAL_FREQ_HIGH);
 	}
+
+	#undef CALIBRATION
 }
 
+#ifdef ENABLE_CHANNEL_TABLE
+	ChannelTableEntry_t gChannelTable[MR_CHANNEL_LAST + 1];
+	uint8_t             gChannelTableCount;
+
+	_Static_assert(sizeof(ChannelTableEntry_t) == 16, "the channel table mirrors the 16 byte EEPROM records");
+
+	bool BOARD_EEPROM_LoadChannelTable(const unsigned int Count)
+	{	// loads the next Count channels, returns true once the whole table is in
+		const unsigned int First = gChannelTableCount;
+		const unsigned int Last  = MIN(First + Count, ARRAY_SIZE(gChannelTable));
+
+		if (First < Last)
+		{	// 0000..0C7F, the table has the same layout as the EEPROM
+			EEPROM_ReadRegion(First * 16, &gChannelTable[First], (Last - First) * sizeof(gChannelTable[0]));
+			gChannelTableCount = Last;
+		}
+
+		return gChannelTableCount >= ARRAY_SIZE(gChannelTable);
+	}
+
+	void BOARD_UpdateChannelTable(uint16_t Address, const void *pData)
+	{	// call after writing 8 bytes to the EEPROM, keeps the table in step with it
+		const uint8_t *pBytes = (const uint8_t *)pData;
+		unsigned int   i;
+
+		for (i = 0; i < 8; i++, Address++)
+			if (Address < sizeof(gChannelTable))
+				((uint8_t *)gChannelTable)[Address] = pBytes[i];
+	}
+#endif
+
 uint32_t BOARD_fetchChannelFrequency(const int channel)
 {
 	struct
@@ -804,6 +856,10 @@ uint32_t BOARD_fetchChannelFrequency(const int channel)
 		uint32_t offset;
 	} __attribute__((packed)) info;
 
+	#ifdef ENABLE_CHANNEL_TABLE
+		if (channel >= 0 && IS_IN_CHANNEL_TABLE(channel))
+			return gChannelTable[channel].Frequency;
+	#endif
 	EEPROM_ReadBuffer(channel * 16, &info, sizeof(info));
 	
 	return info.frequency;
@@ -20,6 +20,26 @@
 #include <stdint.h>
 #include <stdbool.h>
 
+#include "misc.h"
+
+#ifdef ENABLE_CHANNEL_TABLE
+	// RAM copy of the memory channel records, the channel lists and a channel change don't have to
+	// touch I2C for the frequency or the settings. Names stay in the EEPROM, the UI caches the ones it shows
+	typedef struct {
+		uint32_t Frequency;   // 0000 + (channel * 16)
+		uint32_t Offset;      // 0004 + (channel * 16)
+		uint8_t  Data[8];     // 0008 + (channel * 16), CTCSS/DCS codes, modulation, power, step ..
+	} ChannelTableEntry_t;
+
+	extern ChannelTableEntry_t gChannelTable[MR_CHANNEL_LAST + 1];
+	extern uint8_t             gChannelTableCount;   // channels loaded so far, the staged boot fills it from the main loop
+
+	#define IS_IN_CHANNEL_TABLE(x)   ((x) < gChannelTableCount)
+
+	bool BOARD_EEPROM_LoadChannelTable(const unsigned int Count);
+	void BOARD_UpdateChannelTable(uint16_t Address, const void *pData);
+#endif
+
 void     BOARD_FLASH_Init(void);
 void     BOARD_GPIO_Init(void);
 void     BOARD_PORTCON_Init(void);
@@ -27,6 +47,9 @@ void     BOARD_ADC_Init(void);
 void     BOARD_ADC_GetBatteryInfo(uint16_t *pVoltage, uint16_t *pCurrent);
 void     BOARD_Init(void);
 void     BOARD_EEPROM_Init(void);
+#ifdef ENABLE_FMRADIO
+	void BOARD_EEPROM_LoadFMChannels(void);
+#endif
 void     BOARD_EEPROM_LoadCalibration(void);
 uint32_t BOARD_fetchChannelFrequency(const int channel);
 void     BOARD_fetchChannelName(char *s, const int channel);
@@ -84,23 +84,40 @@ uint16_t BK1080_ReadRegister(BK1080_Register_t Register)
 {
 	uint8_t Value[2];
 
+	#ifdef ENABLE_I2C_FAST_MODE
+		I2C_SetFastMode(false);
+	#endif
+
 	I2C_Start();
 	I2C_Write(0x80);
 	I2C_Write((Register << 1) | I2C_READ);
 	I2C_ReadBuffer(Value, sizeof(Value));
 	I2C_Stop();
 
+	#ifdef ENABLE_I2C_FAST_MODE
+		I2C_SetFastMode(true);
+	#endif
+
 	return (Value[0] << 8) | Value[1];
 }
 
 void BK1080_WriteRegister(BK1080_Register_t Register, uint16_t Value)
 {
+	#ifdef ENABLE_I2C_FAST_MODE
+		// the BK1080 isn't rated for fast mode, it gets the 1us timing and the ACK poll
+		I2C_SetFastMode(false);
+	#endif
+
 	I2C_Start();
 	I2C_Write(0x80);
 	I2C_Write((Register << 1) | I2C_WRITE);
 	Value = ((Value >> 8) & 0xFF) | ((Value & 0xFF) << 8);
 	I2C_WriteBuffer(&Value, sizeof(Value));
 	I2C_Stop();
+
+	#ifdef ENABLE_I2C_FAST_MODE
+		I2C_SetFastMode(true);
+	#endif
 }
 
 void BK1080_Mute(bool Mute)
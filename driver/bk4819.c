@@ -15,6 +15,7 @@
  */
 
 #include <stdio.h>   // NULL
+#include <string.h>
 
 #include "audio.h"
 #include "bk4819.h"
@@ -28,12 +29,120 @@
 	#define ARRAY_SIZE(x) (sizeof(x) / sizeof(x[0]))
 #endif
 
+#ifdef ENABLE_BK4819_FAST_BUS
+	// 3-wire bus timing in ns, the same figure is used for the SCL high/low time, data setup/hold
+	// and SCN setup/hold. This is conservative - SYSTICK_DelayUs(1) waits 1us or more for each of these.
+	// utils/bk4819_bus_test.c checks the bus sequence against it
+	#define BUS_HALF_CLOCK_NS  250u
+
+	// the nops alone cover the required time, the GPIO accesses between them only add to it
+	#define BUS_DELAY()   SYSTICK_DELAY_CYCLES(SYSTICK_NS_TO_CYCLES(BUS_HALF_CLOCK_NS))
+
+	// one bit each, unrolled so there's no loop counter or branch between the edges. SDA changes
+	// straight after the SCL falling edge, a whole high time after the rising edge the chip samples
+	// it on, so two delays per bit cover the setup, hold, high and low times
+	#define BUS_WRITE_BIT(Data, Bit)                                                           \
+		do {                                                                                   \
+			GPIOC->DATA = (GPIOC->DATA & ~(1u << GPIOC_PIN_BK4819_SDA)) |                      \
+			              ((((Data) >> (Bit)) & 1u) << GPIOC_PIN_BK4819_SDA);                  \
+			BUS_DELAY();                                                                       \
+			GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCL);                                   \
+			BUS_DELAY();                                                                       \
+			GPIO_ClearBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCL);                                 \
+		} while (0)
+
+	// the chip puts each bit out after an SCL falling edge, it's read a delay later
+	#define BUS_READ_BIT(Value)                                                                \
+		do {                                                                                   \
+			Value = (Value << 1) | GPIO_CheckBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SDA);          \
+			GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCL);                                   \
+			BUS_DELAY();                                                                       \
+			GPIO_ClearBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCL);                                 \
+			BUS_DELAY();                                                                       \
+		} while (0)
+#else
+	#define BUS_DELAY()   SYSTICK_DelayUs(1)
+#endif
+
 static const uint16_t FSK_RogerTable[7] = {0xF1A2, 0x7446, 0x61A4, 0x6544, 0x4E8A, 0xE044, 0xEA84};
 
 static uint16_t gBK4819_GpioOutState;
 
 bool gRxIdleMode;
 
+#ifdef ENABLE_BK4819_SHADOW
+	#define SHADOW_BIT(Register)   (1u << ((Register) & 31u))
+
+	// registers that always read back what was last written to them, only these are kept in the shadow
+	static const uint32_t gShadowCacheable[4] =
+	{
+		SHADOW_BIT(BK4819_REG_19) | SHADOW_BIT(BK4819_REG_1F),
+
+		SHADOW_BIT(BK4819_REG_28) | SHADOW_BIT(BK4819_REG_29) | SHADOW_BIT(BK4819_REG_2B) | SHADOW_BIT(BK4819_REG_31) |
+		SHADOW_BIT(BK4819_REG_33) | SHADOW_BIT(BK4819_REG_36) | SHADOW_BIT(BK4819_REG_37) | SHADOW_BIT(BK4819_REG_38) |
+		SHADOW_BIT(BK4819_REG_39) | SHADOW_BIT(BK4819_REG_3D) | SHADOW_BIT(BK4819_REG_3E) | SHADOW_BIT(BK4819_REG_3F),
+
+		SHADOW_BIT(BK4819_REG_43) | SHADOW_BIT(BK4819_REG_46) | SHADOW_BIT(BK4819_REG_47) | SHADOW_BIT(BK4819_REG_48) |
+		SHADOW_BIT(BK4819_REG_4D) | SHADOW_BIT(BK4819_REG_4E) | SHADOW_BIT(BK4819_REG_4F) | SHADOW_BIT(BK4819_REG_51),
+
+		SHADOW_BIT(BK4819_REG_70) | SHADOW_BIT(BK4819_REG_71) | SHADOW_BIT(0x73)          | SHADOW_BIT(BK4819_REG_78) |
+		SHADOW_BIT(BK4819_REG_79) | SHADOW_BIT(BK4819_REG_7A) | SHADOW_BIT(BK4819_REG_7D)
+	};
+
+	static uint16_t gShadowValue[128];
+	static uint32_t gShadowValid[4];      // the shadow holds the registers current value
+	static uint32_t gShadowDirty[4];      // updated during a batch, not sent to the chip yet
+	static bool     gShadowBatching;
+
+	BK4819_ShadowStats_t gBK4819_ShadowStats;
+
+	static bool ShadowTest(const uint32_t *pBits, const unsigned int Register)
+	{
+		return (pBits[(Register >> 5) & 3u] & SHADOW_BIT(Register)) ? true : false;
+	}
+
+	static void ShadowStore(const unsigned int Register, const uint16_t Data)
+	{
+		if (Register == BK4819_REG_00)
+		{	// soft reset, the chip is back to its defaults
+			memset(gShadowValid, 0, sizeof(gShadowValid));
+			memset(gShadowDirty, 0, sizeof(gShadowDirty));
+			return;
+		}
+
+		if (Register >= ARRAY_SIZE(gShadowValue) || !ShadowTest(gShadowCacheable, Register))
+			return;
+
+		if (gShadowBatching && ShadowTest(gShadowDirty, Register))
+			gBK4819_ShadowStats.WritesSaved++;   // a held back update this write replaces, it never goes out
+
+		gShadowValue[Register] = Data;
+		gShadowValid[Register >> 5] |=  SHADOW_BIT(Register);
+		gShadowDirty[Register >> 5] &= ~SHADOW_BIT(Register);
+	}
+#endif
+
+#ifdef ENABLE_BK4819_IRQ_QUEUE
+	#define IRQ_QUEUE_SIZE        16u          // must be a power of 2
+
+	// single producer (systick interrupt) / single consumer (main loop), no locking needed
+	static BK4819_IrqEvent_t gIrqQueue[IRQ_QUEUE_SIZE];
+	static volatile uint8_t  gIrqQueueHead;    // only written by BK4819_PollInterrupts()
+	static volatile uint8_t  gIrqQueueTail;    // only written by BK4819_GetInterrupt()
+
+	// set while the main loop is in the middle of a bus transaction
+	static volatile uint8_t  gBusBusy;
+	static bool              gIrqPollReady;
+
+	BK4819_IrqStats_t gBK4819_IrqStats;
+
+	#define BUS_ACQUIRE()    gBusBusy++
+	#define BUS_RELEASE()    gBusBusy--
+#else
+	#define BUS_ACQUIRE()
+	#define BUS_RELEASE()
+#endif
+
 __inline uint16_t scale_freq(const uint16_t freq)
 {
 //	return (((uint32_t)freq * 1032444u) + 50000u) / 100000u;   // with rounding
@@ -114,27 +223,42 @@ void BK4819_Init(void)
 
 	BK4819_WriteRegister(BK4819_REG_33, 0x9000);
 	BK4819_WriteRegister(BK4819_REG_3F, 0);
+
+#ifdef ENABLE_BK4819_IRQ_QUEUE
+	// the bus pins are in their idle state from here on
+	gIrqPollReady = true;
+#endif
 }
 
 static uint16_t BK4819_ReadU16(void)
 {
-	unsigned int i;
-	uint16_t     Value;
+	uint16_t Value;
 
 	PORTCON_PORTC_IE = (PORTCON_PORTC_IE & ~PORTCON_PORTC_IE_C2_MASK) | PORTCON_PORTC_IE_C2_BITS_ENABLE;
 	GPIOC->DIR = (GPIOC->DIR & ~GPIO_DIR_2_MASK) | GPIO_DIR_2_BITS_INPUT;
-	SYSTICK_DelayUs(1);
+	BUS_DELAY();
 
 	Value = 0;
-	for (i = 0; i < 16; i++)
+#ifdef ENABLE_BK4819_FAST_BUS
+	BUS_READ_BIT(Value); BUS_READ_BIT(Value); BUS_READ_BIT(Value); BUS_READ_BIT(Value);
+	BUS_READ_BIT(Value); BUS_READ_BIT(Value); BUS_READ_BIT(Value); BUS_READ_BIT(Value);
+	BUS_READ_BIT(Value); BUS_READ_BIT(Value); BUS_READ_BIT(Value); BUS_READ_BIT(Value);
+	BUS_READ_BIT(Value); BUS_READ_BIT(Value); BUS_READ_BIT(Value); BUS_READ_BIT(Value);
+#else
 	{
-		Value <<= 1;
-		Value |= GPIO_CheckBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SDA);
-		GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCL);
-		SYSTICK_DelayUs(1);
-		GPIO_ClearBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCL);
-		SYSTICK_DelayUs(1);
+		unsigned int i;
+
+		for (i = 0; i < 16; i++)
+		{
+			Value <<= 1;
+			Value |= GPIO_CheckBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SDA);
+			GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCL);
+			BUS_DELAY();
+			GPIO_ClearBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCL);
+			BUS_DELAY();
+		}
 	}
+#endif
 	PORTCON_PORTC_IE = (PORTCON_PORTC_IE & ~PORTCON_PORTC_IE_C2_MASK) | PORTCON_PORTC_IE_C2_BITS_DISABLE;
 	GPIOC->DIR = (GPIOC->DIR & ~GPIO_DIR_2_MASK) | GPIO_DIR_2_BITS_OUTPUT;
 
@@ -145,50 +269,128 @@ uint16_t BK4819_ReadRegister(BK4819_REGISTER_t Register)
 {
 	uint16_t Value;
 
+#ifdef ENABLE_BK4819_SHADOW
+	if (Register < ARRAY_SIZE(gShadowValue) && ShadowTest(gShadowValid, Register))
+	{	// also covers registers still waiting for BK4819_CommitBatch()
+		gBK4819_ShadowStats.ReadsSaved++;
+		return gShadowValue[Register];
+	}
+#endif
+
+	BUS_ACQUIRE();
+
 	GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCN);
 	GPIO_ClearBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCL);
 
-	SYSTICK_DelayUs(1);
+	BUS_DELAY();
 
 	GPIO_ClearBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCN);
 	BK4819_WriteU8(Register | 0x80);
 	Value = BK4819_ReadU16();
 	GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCN);
 
-	SYSTICK_DelayUs(1);
+	BUS_DELAY();
 
 	GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCL);
 	GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SDA);
 
+	BUS_RELEASE();
+
 	return Value;
 }
 
 void BK4819_WriteRegister(BK4819_REGISTER_t Register, uint16_t Data)
 {
+	BUS_ACQUIRE();
+
 	GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCN);
 	GPIO_ClearBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCL);
 
-	SYSTICK_DelayUs(1);
+	BUS_DELAY();
 
 	GPIO_ClearBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCN);
 	BK4819_WriteU8(Register);
 
-	SYSTICK_DelayUs(1);
+	BUS_DELAY();
 
 	BK4819_WriteU16(Data);
 
-	SYSTICK_DelayUs(1);
+	BUS_DELAY();
 
 	GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCN);
 
-	SYSTICK_DelayUs(1);
+	BUS_DELAY();
 
 	GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCL);
 	GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SDA);
+
+	BUS_RELEASE();
+
+#ifdef ENABLE_BK4819_SHADOW
+	ShadowStore(Register, Data);
+#endif
+}
+
+void BK4819_UpdateRegister(BK4819_REGISTER_t Register, uint16_t Data)
+{	// same as BK4819_WriteRegister() but skips writes that wouldn't change anything,
+	// only for registers that don't have side effects when written
+#ifdef ENABLE_BK4819_SHADOW
+	if (Register < ARRAY_SIZE(gShadowValue) && ShadowTest(gShadowValid, Register))
+	{
+		if (gShadowValue[Register] == Data)
+		{
+			gBK4819_ShadowStats.WritesSaved++;
+			return;
+		}
+
+		if (gShadowBatching)
+		{	// the last value wins when the batch is committed
+			if (ShadowTest(gShadowDirty, Register))
+				gBK4819_ShadowStats.WritesSaved++;
+
+			gShadowValue[Register] = Data;
+			gShadowDirty[Register >> 5] |= SHADOW_BIT(Register);
+			return;
+		}
+	}
+#endif
+
+	BK4819_WriteRegister(Register, Data);
+}
+
+void BK4819_UpdateRegisterBits(BK4819_REGISTER_t Register, uint16_t Mask, uint16_t Value)
+{	// read-modify-write, the read comes from the shadow when it can
+	const uint16_t Data = BK4819_ReadRegister(Register);
+	BK4819_UpdateRegister(Register, (Data & ~Mask) | (Value & Mask));
+}
+
+void BK4819_BeginBatch(void)
+{	// hold back BK4819_UpdateRegister() writes until BK4819_CommitBatch()
+#ifdef ENABLE_BK4819_SHADOW
+	gShadowBatching = true;
+#endif
+}
+
+void BK4819_CommitBatch(void)
+{	// send the registers changed since BK4819_BeginBatch(), once each in register order
+#ifdef ENABLE_BK4819_SHADOW
+	unsigned int Register;
+
+	gShadowBatching = false;
+
+	for (Register = 0; Register < ARRAY_SIZE(gShadowValue); Register++)
+		if (ShadowTest(gShadowDirty, Register))
+			BK4819_WriteRegister(Register, gShadowValue[Register]);
+#endif
 }
 
 void BK4819_WriteU8(uint8_t Data)
 {
+#ifdef ENABLE_BK4819_FAST_BUS
+	GPIO_ClearBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCL);
+	BUS_WRITE_BIT(Data, 7); BUS_WRITE_BIT(Data, 6); BUS_WRITE_BIT(Data, 5); BUS_WRITE_BIT(Data, 4);
+	BUS_WRITE_BIT(Data, 3); BUS_WRITE_BIT(Data, 2); BUS_WRITE_BIT(Data, 1); BUS_WRITE_BIT(Data, 0);
+#else
 	unsigned int i;
 
 	GPIO_ClearBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCL);
@@ -199,19 +401,27 @@ void BK4819_WriteU8(uint8_t Data)
 		else
 			GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SDA);
 
-		SYSTICK_DelayUs(1);
+		BUS_DELAY();
 		GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCL);
-		SYSTICK_DelayUs(1);
+		BUS_DELAY();
 
 		Data <<= 1;
 
 		GPIO_ClearBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCL);
-		SYSTICK_DelayUs(1);
+		BUS_DELAY();
 	}
+#endif
 }
 
 void BK4819_WriteU16(uint16_t Data)
 {
+#ifdef ENABLE_BK4819_FAST_BUS
+	GPIO_ClearBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCL);
+	BUS_WRITE_BIT(Data, 15); BUS_WRITE_BIT(Data, 14); BUS_WRITE_BIT(Data, 13); BUS_WRITE_BIT(Data, 12);
+	BUS_WRITE_BIT(Data, 11); BUS_WRITE_BIT(Data, 10); BUS_WRITE_BIT(Data,  9); BUS_WRITE_BIT(Data,  8);
+	BUS_WRITE_BIT(Data,  7); BUS_WRITE_BIT(Data,  6); BUS_WRITE_BIT(Data,  5); BUS_WRITE_BIT(Data,  4);
+	BUS_WRITE_BIT(Data,  3); BUS_WRITE_BIT(Data,  2); BUS_WRITE_BIT(Data,  1); BUS_WRITE_BIT(Data,  0);
+#else
 	unsigned int i;
 
 	GPIO_ClearBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCL);
@@ -222,15 +432,16 @@ void BK4819_WriteU16(uint16_t Data)
 		else
 			GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SDA);
 
-		SYSTICK_DelayUs(1);
+		BUS_DELAY();
 		GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCL);
 
 		Data <<= 1;
 
-		SYSTICK_DelayUs(1);
+		BUS_DELAY();
 		GPIO_ClearBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCL);
-		SYSTICK_DelayUs(1);
+		BUS_DELAY();
 	}
+#endif
 }
 
 void BK4819_DisableAGC()
@@ -350,7 +561,7 @@ void BK4819_ToggleGpioOut(BK4819_GPIO_PIN_t Pin, bool bSet)
 	else
 		gBK4819_GpioOutState &= ~(0x40u >> Pin);
 
-	BK4819_WriteRegister(BK4819_REG_33, gBK4819_GpioOutState);
+	BK4819_UpdateRegister(BK4819_REG_33, gBK4819_GpioOutState);
 }
 
 void BK4819_SetCDCSSCodeWord(uint32_t CodeWord)
@@ -523,8 +734,6 @@ void BK4819_EnableVox(uint16_t VoxEnableThreshold, uint16_t VoxDisableThreshold)
 	//else
 	//if (voxamp<VoxDisableThreshold) (After Delay) VOX = 0;
 
-	const uint16_t REG_31_Value = BK4819_ReadRegister(BK4819_REG_31);
-
 	// 0xA000 is undocumented?
 	BK4819_WriteRegister(BK4819_REG_46, 0xA000 | (VoxEnableThreshold & 0x07FF));
 
@@ -535,7 +744,7 @@ void BK4819_EnableVox(uint16_t VoxEnableThreshold, uint16_t VoxDisableThreshold)
 	BK4819_WriteRegister(BK4819_REG_7A, 0x289A); // vox disable delay = 128*5 = 640ms
 
 	// Enable VOX
-	BK4819_WriteRegister(BK4819_REG_31, REG_31_Value | (1u << 2));    // VOX Enable
+	BK4819_UpdateRegisterBits(BK4819_REG_31, 1u << 2, 1u << 2);    // VOX Enable
 }
 
 void BK4819_SetFilterBandwidth(const BK4819_FilterBandwidth_t Bandwidth, const bool weak_no_different)
@@ -675,7 +884,7 @@ void BK4819_SetFilterBandwidth(const BK4819_FilterBandwidth_t Bandwidth, const b
 			break;
 	}
 
-	BK4819_WriteRegister(BK4819_REG_43, val);
+	BK4819_UpdateRegister(BK4819_REG_43, val);
 }
 
 void BK4819_SetupPowerAmplifier(const uint8_t bias, const uint32_t frequency)
@@ -699,13 +908,13 @@ void BK4819_SetupPowerAmplifier(const uint8_t bias, const uint32_t frequency)
 	//                                  280MHz       gain 1 = 1  gain 2 = 0  gain 1 = 4  gain 2 = 2
 	const uint8_t gain   = (frequency < 28000000) ? (1u << 3) | (0u << 0) : (4u << 3) | (2u << 0);
 	const uint8_t enable = 1;
-	BK4819_WriteRegister(BK4819_REG_36, (bias << 8) | (enable << 7) | (gain << 0));
+	BK4819_UpdateRegister(BK4819_REG_36, (bias << 8) | (enable << 7) | (gain << 0));
 }
 
 void BK4819_SetFrequency(uint32_t Frequency)
 {
-	BK4819_WriteRegister(BK4819_REG_38, (Frequency >>  0) & 0xFFFF);
-	BK4819_WriteRegister(BK4819_REG_39, (Frequency >> 16) & 0xFFFF);
+	BK4819_UpdateRegister(BK4819_REG_38, (Frequency >>  0) & 0xFFFF);
+	BK4819_UpdateRegister(BK4819_REG_39, (Frequency >> 16) & 0xFFFF);
 }
 
 void BK4819_SetupSquelch(
@@ -732,13 +941,13 @@ void BK4819_SetupSquelch(
 	// <6:0>  0 TONE2/FSK tuning gain
 	//        0 ~ 127
 	//
-	BK4819_WriteRegister(BK4819_REG_70, 0);
+	BK4819_UpdateRegister(BK4819_REG_70, 0);
 
 	// Glitch threshold for Squelch = close
 	//
 	// 0 ~ 255
 	//
-	BK4819_WriteRegister(BK4819_REG_4D, 0xA000 | SquelchCloseGlitchThresh);
+	BK4819_UpdateRegister(BK4819_REG_4D, 0xA000 | SquelchCloseGlitchThresh);
 
 	// REG_4E
 	//
@@ -755,7 +964,7 @@ void BK4819_SetupSquelch(
 	// <7:0>   8 Glitch threshold for Squelch = open
 	//         0 ~ 255
 	//
-	BK4819_WriteRegister(BK4819_REG_4E,  // 01 101 11 1 00000000
+	BK4819_UpdateRegister(BK4819_REG_4E,  // 01 101 11 1 00000000
 
 		// original (*)
 	(1u << 14) |                  //  1 ???
@@ -774,7 +983,7 @@ void BK4819_SetupSquelch(
 	// <6:0>  46 Ex-noise threshold for Squelch = open
 	//        0 ~ 127
 	//
-	BK4819_WriteRegister(BK4819_REG_4F, ((uint16_t)SquelchCloseNoiseThresh << 8) | SquelchOpenNoiseThresh);
+	BK4819_UpdateRegister(BK4819_REG_4F, ((uint16_t)SquelchCloseNoiseThresh << 8) | SquelchOpenNoiseThresh);
 
 	// REG_78
 	//
@@ -782,7 +991,7 @@ void BK4819_SetupSquelch(
 	//
 	// <7:0>  70 RSSI threshold for Squelch = close   0.5dB/step
 	//
-	BK4819_WriteRegister(BK4819_REG_78, ((uint16_t)SquelchOpenRSSIThresh   << 8) | SquelchCloseRSSIThresh);
+	BK4819_UpdateRegister(BK4819_REG_78, ((uint16_t)SquelchOpenRSSIThresh   << 8) | SquelchCloseRSSIThresh);
 
 	BK4819_SetAF(BK4819_AF_MUTE);
 
@@ -795,13 +1004,70 @@ void BK4819_SetAF(BK4819_AF_Type_t AF)
 	// Undocumented bits 0x2040
 	//
 //	BK4819_WriteRegister(BK4819_REG_47, 0x6040 | (AF << 8));
-	BK4819_WriteRegister(BK4819_REG_47, (6u << 12) | (AF << 8) | (1u << 6));
+	BK4819_UpdateRegister(BK4819_REG_47, (6u << 12) | (AF << 8) | (1u << 6));
+}
+
+#ifdef ENABLE_BK4819_IRQ_QUEUE
+// called from the systick interrupt, moves a pending chip interrupt into the queue,
+// one per tick so the interrupt stays well inside the 1ms period (the queue drains at 1kHz)
+void BK4819_PollInterrupts(void)
+{
+	if (!gIrqPollReady)
+		return;
+
+	if (gBusBusy)
+	{	// the main loop owns the bus right now, try again on the next tick
+		gBK4819_IrqStats.PollsDeferred++;
+		return;
+	}
+
+	const uint8_t      Head   = gIrqQueueHead;
+	const uint16_t     Reg0C  = BK4819_ReadRegister(BK4819_REG_0C);
+	BK4819_IrqEvent_t *pEvent = &gIrqQueue[Head & (IRQ_QUEUE_SIZE - 1)];
+
+	if ((Reg0C & 1u) == 0)
+		return;
+
+	if ((uint8_t)(Head - gIrqQueueTail) >= IRQ_QUEUE_SIZE)
+	{	// queue is full, leave the interrupt pending in the chip
+		gBK4819_IrqStats.Overflows++;
+		return;
+	}
+
+	// reset the interrupt and fetch the status bits
+	BK4819_WriteRegister(BK4819_REG_02, 0);
+	pEvent->Status        = BK4819_ReadRegister(BK4819_REG_02);
+
+	// these only hold while the interrupt is fresh, so latch them now
+	pEvent->CDCSSCodeType = (Reg0C >> 14) & 3u;
+	pEvent->DTMFCode      = (pEvent->Status & BK4819_REG_02_DTMF_5TONE_FOUND) ? BK4819_GetDTMF_5TONE_Code() : 0;
+
+	gIrqQueueHead = Head + 1;
+	gBK4819_IrqStats.Events++;
+}
+
+bool BK4819_GetInterrupt(BK4819_IrqEvent_t *pEvent)
+{
+	const uint8_t Tail = gIrqQueueTail;
+
+	if (Tail == gIrqQueueHead)
+		return false;
+
+	*pEvent = gIrqQueue[Tail & (IRQ_QUEUE_SIZE - 1)];
+
+	gIrqQueueTail = Tail + 1;
+
+	return true;
 }
 
+void BK4819_FlushInterrupts(void)
+{	// drop what was queued for the previous channel, the consumer owns the tail
+	gIrqQueueTail = gIrqQueueHead;
+}
+#endif
+
 void BK4819_SetRegValue(RegisterSpec s, uint16_t v) {
-  uint16_t reg = BK4819_ReadRegister(s.num);
-  reg &= ~(s.mask << s.offset);
-  BK4819_WriteRegister(s.num, reg | (v << s.offset));
+  BK4819_UpdateRegisterBits(s.num, s.mask << s.offset, v << s.offset);
 }
 
 void BK4819_RX_TurnOn(void)
@@ -859,16 +1125,14 @@ void BK4819_PickRXFilterPathBasedOnFrequency(uint32_t Frequency)
 
 void BK4819_DisableScramble(void)
 {
-	const uint16_t Value = BK4819_ReadRegister(BK4819_REG_31);
-	BK4819_WriteRegister(BK4819_REG_31, Value & ~(1u << 1));
+	BK4819_UpdateRegisterBits(BK4819_REG_31, 1u << 1, 0);
 }
 
 void BK4819_EnableScramble(uint8_t Type)
 {
-	const uint16_t Value = BK4819_ReadRegister(BK4819_REG_31);
-	BK4819_WriteRegister(BK4819_REG_31, Value | (1u << 1));
+	BK4819_UpdateRegisterBits(BK4819_REG_31, 1u << 1, 1u << 1);
 
-	BK4819_WriteRegister(BK4819_REG_71, 0x68DC + (Type * 1032));   // 0110 1000 1101 1100
+	BK4819_UpdateRegister(BK4819_REG_71, 0x68DC + (Type * 1032));   // 0110 1000 1101 1100
 }
 
 bool BK4819_CompanderEnabled(void)
@@ -883,11 +1147,9 @@ void BK4819_SetCompander(const unsigned int mode)
 	// mode 2 .. RX
 	// mode 3 .. TX and RX
 
-	const uint16_t r31 = BK4819_ReadRegister(BK4819_REG_31);
-
 	if (mode == 0)
 	{	// disable
-		BK4819_WriteRegister(BK4819_REG_31, r31 & ~(1u << 3));
+		BK4819_UpdateRegisterBits(BK4819_REG_31, 1u << 3, 0);
 		return;
 	}
 
@@ -907,7 +1169,7 @@ void BK4819_SetCompander(const unsigned int mode)
 	const uint16_t compress_0dB      = 86;
 	const uint16_t compress_noise_dB = 64;
 //	AB40  10 1010110 1000000
-	BK4819_WriteRegister(BK4819_REG_29, // (BK4819_ReadRegister(BK4819_REG_29) & ~(3u << 14)) | (compress_ratio << 14));
+	BK4819_UpdateRegister(BK4819_REG_29, // (BK4819_ReadRegister(BK4819_REG_29) & ~(3u << 14)) | (compress_ratio << 14));
 		(compress_ratio    << 14) |
 		(compress_0dB      <<  7) |
 		(compress_noise_dB <<  0));
@@ -928,19 +1190,18 @@ void BK4819_SetCompander(const unsigned int mode)
 	const uint16_t expand_0dB      = 86;
 	const uint16_t expand_noise_dB = 56;
 //	6B38  01 1010110 0111000
-	BK4819_WriteRegister(BK4819_REG_28, // (BK4819_ReadRegister(BK4819_REG_28) & ~(3u << 14)) | (expand_ratio << 14));
+	BK4819_UpdateRegister(BK4819_REG_28, // (BK4819_ReadRegister(BK4819_REG_28) & ~(3u << 14)) | (expand_ratio << 14));
 		(expand_ratio    << 14) |
 		(expand_0dB      <<  7) |
 		(expand_noise_dB <<  0));
 
 	// enable
-	BK4819_WriteRegister(BK4819_REG_31, r31 | (1u << 3));
+	BK4819_UpdateRegisterBits(BK4819_REG_31, 1u << 3, 1u << 3);
 }
 
 void BK4819_DisableVox(void)
 {
-	const uint16_t Value = BK4819_ReadRegister(BK4819_REG_31);
-	BK4819_WriteRegister(BK4819_REG_31, Value & 0xFFFB);
+	BK4819_UpdateRegisterBits(BK4819_REG_31, 1u << 2, 0);
 }
 
 void BK4819_DisableDTMF(void)
@@ -1464,6 +1725,42 @@ uint8_t  BK4819_GetExNoiceIndicator(void)
 	return BK4819_ReadRegister(BK4819_REG_65) & 0x007F;
 }
 
+// how long BK4819_WaitForLock() took, for tuning the scan and spectrum step times
+static uint16_t gLockHistogram[BK4819_LOCK_HISTOGRAM_BINS];
+
+bool BK4819_WaitForLock(const uint16_t Timeout_us)
+{	// the chip has no lock flag we can read, but the glitch indicator sits at 255 from the retune
+	// until the synthesizer and the demodulator have settled, after that RSSI and noise are good
+	unsigned int Polls = 0;
+	unsigned int Bin   = 0;
+	bool         bLocked;
+
+	while (!(bLocked = BK4819_GetGlitchIndicator() < 255) && Polls * BK4819_LOCK_POLL_US < Timeout_us)
+	{
+		SYSTICK_DelayUs(BK4819_LOCK_POLL_US);
+		Polls++;
+	}
+
+	if (!bLocked)
+		Bin = BK4819_LOCK_HISTOGRAM_BINS - 1;
+	else
+		while (Polls > 0 && Bin < BK4819_LOCK_HISTOGRAM_BINS - 2)
+		{	// 1 poll to bin 1, 2 to bin 2, 3..4 to bin 3 and so on
+			Bin++;
+			Polls = (Polls == 1) ? 0 : (Polls + 1) / 2;
+		}
+
+	if (gLockHistogram[Bin] < UINT16_MAX)
+		gLockHistogram[Bin]++;
+
+	return bLocked;
+}
+
+const uint16_t *BK4819_GetLockHistogram(void)
+{
+	return gLockHistogram;
+}
+
 uint16_t BK4819_GetVoiceAmplitudeOut(void)
 {
 	return BK4819_ReadRegister(BK4819_REG_64);
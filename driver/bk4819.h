@@ -65,10 +65,43 @@ typedef enum BK4819_CssScanResult_t BK4819_CssScanResult_t;
 // radio is asleep, not listening
 extern bool gRxIdleMode;
 
+#ifdef ENABLE_BK4819_SHADOW
+	typedef struct {
+		uint32_t ReadsSaved;      // register reads answered from the shadow
+		uint32_t WritesSaved;     // writes skipped because the register already held the value, or a later one in the batch replaced them
+	} BK4819_ShadowStats_t;
+
+	extern BK4819_ShadowStats_t gBK4819_ShadowStats;
+#endif
+
+#ifdef ENABLE_BK4819_IRQ_QUEUE
+	typedef struct {
+		uint16_t Status;          // REG_02 interrupt status bits
+		uint8_t  CDCSSCodeType;   // REG_0C <15:14> at the time of the interrupt
+		uint8_t  DTMFCode;        // REG_0B <11:8>, only with BK4819_REG_02_DTMF_5TONE_FOUND
+	} BK4819_IrqEvent_t;
+
+	typedef struct {
+		uint32_t Events;          // interrupts moved into the queue
+		uint32_t PollsDeferred;   // polls skipped because the bus was in use
+		uint32_t Overflows;       // polls that found the queue full
+	} BK4819_IrqStats_t;
+
+	extern BK4819_IrqStats_t gBK4819_IrqStats;
+
+	void BK4819_PollInterrupts(void);
+	bool BK4819_GetInterrupt(BK4819_IrqEvent_t *pEvent);
+	void BK4819_FlushInterrupts(void);
+#endif
+
 void     BK4819_Init(void);
 uint16_t BK4819_ReadRegister(BK4819_REGISTER_t Register);
 void     BK4819_WriteRegister(BK4819_REGISTER_t Register, uint16_t Data);
 void     BK4819_SetRegValue(RegisterSpec s, uint16_t v);
+void     BK4819_UpdateRegister(BK4819_REGISTER_t Register, uint16_t Data);
+void     BK4819_UpdateRegisterBits(BK4819_REGISTER_t Register, uint16_t Mask, uint16_t Value);
+void     BK4819_BeginBatch(void);
+void     BK4819_CommitBatch(void);
 void     BK4819_WriteU8(uint8_t Data);
 void     BK4819_WriteU16(uint16_t Data);
 
@@ -138,6 +171,12 @@ void     BK4819_EnableCTCSS(void);
 uint16_t BK4819_GetRSSI(void);
 uint8_t  BK4819_GetGlitchIndicator(void);
 uint8_t  BK4819_GetExNoiceIndicator(void);
+
+// polls after a retune until the RX measurements are valid, or Timeout_us runs out, returns true if they are
+#define  BK4819_LOCK_POLL_US          100u
+#define  BK4819_LOCK_HISTOGRAM_BINS   8u    // no wait, 1, 2, 3-4, 5-8, 9-16, more polls, timed out
+bool     BK4819_WaitForLock(const uint16_t Timeout_us);
+const uint16_t *BK4819_GetLockHistogram(void);
 uint16_t BK4819_GetVoiceAmplitudeOut(void);
 uint8_t  BK4819_GetAfTxRx(void);
 
@@ -14,37 +14,148 @@
  *     limitations under the License.
  */
 
-#include "bsp/dp32g030/crc.h"
+#include <stdbool.h>
+
+#ifndef ENABLE_CRC_SOFTWARE
+	#include "bsp/dp32g030/crc.h"
+#endif
 #include "driver/crc.h"
 
+#ifdef ENABLE_CRC_SOFTWARE
+	// slice-by-4 tables, gCrcTable[n][x] is the CRC of byte x followed by n zero bytes,
+	// built at init so they cost RAM rather than flash, meant for host builds
+	static uint16_t gCrcTable[4][256];
+#else
+	// whether the peripheral takes 32-bit words the way we want them, found out by CRC_Init()
+	static bool gCrcWordFeed;
+	static bool gCrcWordSwap;
+
+	static void SetDataWidth(const uint32_t Width)
+	{
+		CRC_CR = (CRC_CR & ~CRC_CR_DATA_WIDTH_MASK) | Width;
+	}
+#endif
+
 void CRC_Init(void)
 {
-	CRC_CR = 0
-		| CRC_CR_CRC_EN_BITS_DISABLE
-		| CRC_CR_INPUT_REV_BITS_NORMAL
-		| CRC_CR_INPUT_INV_BITS_NORMAL
-		| CRC_CR_OUTPUT_REV_BITS_NORMAL
-		| CRC_CR_OUTPUT_INV_BITS_NORMAL
-		| CRC_CR_DATA_WIDTH_BITS_8
-		| CRC_CR_CRC_SEL_BITS_CRC_16_CCITT
-		;
-	CRC_IV = 0;
+	#ifdef ENABLE_CRC_SOFTWARE
+		unsigned int i;
+		unsigned int n;
+
+		for (i = 0; i < 256; i++)
+		{
+			uint16_t Crc = i << 8;
+
+			for (n = 0; n < 8; n++)
+				Crc = (Crc << 1) ^ ((Crc & 0x8000U) ? 0x1021U : 0U);
+
+			gCrcTable[0][i] = Crc;
+		}
+
+		for (n = 1; n < 4; n++)
+			for (i = 0; i < 256; i++)
+				gCrcTable[n][i] = (gCrcTable[n - 1][i] << 8) ^ gCrcTable[0][gCrcTable[n - 1][i] >> 8];
+	#else
+		static const uint32_t Probe[3] = { 0x04030201U, 0x89ABCDEFU, 0x5A0FF0A5U };
+		uint16_t              Expected;
+
+		CRC_CR = 0
+			| CRC_CR_CRC_EN_BITS_DISABLE
+			| CRC_CR_INPUT_REV_BITS_NORMAL
+			| CRC_CR_INPUT_INV_BITS_NORMAL
+			| CRC_CR_OUTPUT_REV_BITS_NORMAL
+			| CRC_CR_OUTPUT_INV_BITS_NORMAL
+			| CRC_CR_DATA_WIDTH_BITS_8
+			| CRC_CR_CRC_SEL_BITS_CRC_16_CCITT
+			;
+		CRC_IV = 0;
+
+		// the data sheet doesn't say which end of a 32-bit word goes in first,
+		// so only feed words if one of the two byte orders matches feeding bytes
+		gCrcWordFeed = false;
+		Expected     = CRC_Calculate(Probe, sizeof(Probe));
+
+		gCrcWordFeed = true;
+		gCrcWordSwap = true;
+		if (CRC_Calculate(Probe, sizeof(Probe)) == Expected)
+			return;
+
+		gCrcWordSwap = false;
+		if (CRC_Calculate(Probe, sizeof(Probe)) == Expected)
+			return;
+
+		gCrcWordFeed = false;
+	#endif
 }
 
-uint16_t CRC_Calculate(const void *pBuffer, uint16_t Size)
+void CRC_Begin(CRC_Context_t *pContext)
+{
+	pContext->Crc = 0;
+}
+
+void CRC_Update(CRC_Context_t *pContext, const void *pBuffer, uint16_t Size)
 {
 	const uint8_t *pData = (const uint8_t *)pBuffer;
-	uint16_t i, Crc;
 
-	CRC_CR = (CRC_CR & ~CRC_CR_CRC_EN_MASK) | CRC_CR_CRC_EN_BITS_ENABLE;
+	#ifdef ENABLE_CRC_SOFTWARE
+		uint16_t Crc = pContext->Crc;
 
-	for (i = 0; i < Size; i++) {
-		CRC_DATAIN = pData[i];
-	}
-	Crc = (uint16_t)CRC_DATAOUT;
+		for (; Size >= 4; Size -= 4, pData += 4)
+		{
+			Crc ^= (pData[0] << 8) | pData[1];
+			Crc  = gCrcTable[3][Crc >> 8] ^ gCrcTable[2][Crc & 0xFFU] ^ gCrcTable[1][pData[2]] ^ gCrcTable[0][pData[3]];
+		}
+
+		for (; Size > 0; Size--)
+			Crc = (Crc << 8) ^ gCrcTable[0][(Crc >> 8) ^ *pData++];
+
+		pContext->Crc = Crc;
+	#else
+		// carry on from where the last piece left off. This takes it that the peripheral starts from CRC_IV
+		// each time it is enabled, which hasn't been checked on a radio; the software path is checked by
+		// utils/crc_test.c
+		CRC_IV = pContext->Crc;
+		CRC_CR = (CRC_CR & ~CRC_CR_CRC_EN_MASK) | CRC_CR_CRC_EN_BITS_ENABLE;
+
+		if (gCrcWordFeed)
+		{
+			for (; Size > 0 && ((uintptr_t)pData & 3U) != 0; Size--)
+				CRC_DATAIN = *pData++;
+
+			if (Size >= 4)
+			{
+				SetDataWidth(CRC_CR_DATA_WIDTH_BITS_32);
+
+				for (; Size >= 4; Size -= 4, pData += 4)
+				{
+					const uint32_t Word = *(const uint32_t *)pData;
+					CRC_DATAIN = gCrcWordSwap ? __builtin_bswap32(Word) : Word;
+				}
+
+				SetDataWidth(CRC_CR_DATA_WIDTH_BITS_8);
+			}
+		}
+
+		for (; Size > 0; Size--)
+			CRC_DATAIN = *pData++;
 
-	CRC_CR = (CRC_CR & ~CRC_CR_CRC_EN_MASK) | CRC_CR_CRC_EN_BITS_DISABLE;
+		pContext->Crc = (uint16_t)CRC_DATAOUT;
 
-	return Crc;
+		CRC_CR = (CRC_CR & ~CRC_CR_CRC_EN_MASK) | CRC_CR_CRC_EN_BITS_DISABLE;
+	#endif
 }
 
+uint16_t CRC_End(const CRC_Context_t *pContext)
+{
+	return pContext->Crc;
+}
+
+uint16_t CRC_Calculate(const void *pBuffer, uint16_t Size)
+{
+	CRC_Context_t Context;
+
+	CRC_Begin(&Context);
+	CRC_Update(&Context, pBuffer, Size);
+
+	return CRC_End(&Context);
+}
@@ -19,8 +19,16 @@
 
 #include <stdint.h>
 
-void CRC_Init(void);
+// CRC-16/XMODEM (CCITT polynomial, zero seed), the running value is all the state there is,
+// so a CRC can be fed in pieces, e.g. straight out of a DMA ring buffer
+typedef struct {
+	uint16_t Crc;
+} CRC_Context_t;
+
+void     CRC_Init(void);
+void     CRC_Begin(CRC_Context_t *pContext);
+void     CRC_Update(CRC_Context_t *pContext, const void *pBuffer, uint16_t Size);
+uint16_t CRC_End(const CRC_Context_t *pContext);
 uint16_t CRC_Calculate(const void *pBuffer, uint16_t Size);
 
 #endif
-
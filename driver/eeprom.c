@@ -14,6 +14,7 @@
  *     limitations under the License.
  */
 
+#include <stdbool.h>
 #include <stddef.h>
 #include <string.h>
 
@@ -21,8 +22,136 @@
 #include "driver/i2c.h"
 #include "driver/system.h"
 
-void EEPROM_ReadBuffer(uint16_t Address, void *pBuffer, uint8_t Size)
+uint16_t gEepromWriteCount;
+
+#ifdef ENABLE_EEPROM_WRITE_BEHIND
+	#define EEPROM_PAGE_SIZE     32u   // BL24C64
+	#define EEPROM_QUEUE_LENGTH  4u
+
+	typedef struct {
+		uint16_t Address;                  // page aligned
+		uint8_t  Dirty;                    // one bit per 8 byte block still to be written
+		uint8_t  Data[EEPROM_PAGE_SIZE];   // whole page, so any span of it can be written out
+	} EEPROM_PendingPage_t;
+
+	// oldest page first
+	static EEPROM_PendingPage_t gEepromQueue[EEPROM_QUEUE_LENGTH];
+	static uint8_t              gEepromQueueCount;
+
+	// the chip is burning in the last page write and won't answer until it's done
+	static bool                 gEepromBusy;
+
+	static void WaitReady(void)
+	{	// acknowledge polling, gives up after about 10ms in case nothing is there to answer
+		unsigned int i;
+
+		for (i = 0; gEepromBusy && i < 255; i++)
+		{
+			I2C_Start();
+			if (I2C_Write(0xA0) == 0)
+				gEepromBusy = false;
+			I2C_Stop();
+		}
+
+		gEepromBusy = false;
+	}
+
+	static EEPROM_PendingPage_t *FindPage(const uint16_t Address)
+	{
+		unsigned int i;
+		for (i = 0; i < gEepromQueueCount; i++)
+			if (gEepromQueue[i].Address == Address)
+				return &gEepromQueue[i];
+		return NULL;
+	}
+
+	static void DropOldest(void)
+	{
+		gEepromQueueCount--;
+		memmove(&gEepromQueue[0], &gEepromQueue[1], gEepromQueueCount * sizeof(gEepromQueue[0]));
+	}
+
+	static bool WriteOldest(void)
+	{	// returns false if the chip is still busy with the previous write
+		const EEPROM_PendingPage_t *pPage = &gEepromQueue[0];
+		unsigned int                First = 0;
+		unsigned int                Last  = (EEPROM_PAGE_SIZE / 8) - 1;
+		uint16_t                    Address;
+
+		while ((pPage->Dirty & (1u << First)) == 0)
+			First++;
+		while ((pPage->Dirty & (1u << Last)) == 0)
+			Last--;
+
+		I2C_Start();
+
+		if (I2C_Write(0xA0) < 0)
+		{
+			I2C_Stop();
+			return false;
+		}
+
+		// the blocks in between that didn't change are rewritten with what's already there
+		Address = pPage->Address + (First * 8);
+		I2C_Write((Address >> 8) & 0xFF);
+		I2C_Write((Address >> 0) & 0xFF);
+		I2C_WriteBuffer(&pPage->Data[First * 8], (Last + 1 - First) * 8);
+
+		I2C_Stop();
+
+		gEepromBusy = true;
+
+		DropOldest();
+
+		return true;
+	}
+
+	static void OverlayPending(const uint16_t Address, uint8_t *pBuffer, const uint16_t Size)
+	{
+		unsigned int i;
+
+		for (i = 0; i < gEepromQueueCount; i++)
+		{
+			const EEPROM_PendingPage_t *pPage = &gEepromQueue[i];
+			const unsigned int          Start = (pPage->Address > Address) ? pPage->Address : Address;
+			const unsigned int          End   = ((pPage->Address + EEPROM_PAGE_SIZE) < (Address + Size)) ? pPage->Address + EEPROM_PAGE_SIZE : Address + Size;
+
+			if (Start < End)
+				memcpy(pBuffer + (Start - Address), &pPage->Data[Start - pPage->Address], End - Start);
+		}
+	}
+
+	void EEPROM_Service(void)
+	{
+		if (gEepromQueueCount > 0)
+			WriteOldest();
+	}
+
+	void EEPROM_Flush(void)
+	{
+		while (gEepromQueueCount > 0)
+		{
+			WaitReady();
+			if (!WriteOldest())
+				DropOldest();   // nobody is answering, don't hang the radio
+		}
+
+		WaitReady();
+	}
+#endif
+
+void EEPROM_ReadRecords(uint16_t Address, uint16_t Stride, void *pBuffer, uint16_t BufferStride, uint16_t Size, uint16_t Count)
 {
+	uint8_t     *pRecord = (uint8_t *)pBuffer;
+	unsigned int i;
+
+	if (Count == 0 || Size == 0 || Size > Stride)
+		return;
+
+#ifdef ENABLE_EEPROM_WRITE_BEHIND
+	WaitReady();
+#endif
+
 	I2C_Start();
 
 	I2C_Write(0xA0);
@@ -34,9 +163,37 @@ void EEPROM_ReadBuffer(uint16_t Address, void *pBuffer, uint8_t Size)
 
 	I2C_Write(0xA1);
 
-	I2C_ReadBuffer(pBuffer, Size);
+	// one sequential read, the gaps between the records are clocked through and dropped
+	for (i = 0; i < Count; i++, pRecord += BufferStride)
+	{
+		const unsigned int Length = (i < (Count - 1u)) ? Stride : Size;
+		unsigned int       k;
+
+		for (k = 0; k < Length; k++)
+		{
+			const uint8_t Data = I2C_Read(i == (Count - 1u) && k == (Length - 1u));
+			if (k < Size)
+				pRecord[k] = Data;
+		}
+	}
 
 	I2C_Stop();
+
+#ifdef ENABLE_EEPROM_WRITE_BEHIND
+	// pages still waiting in the queue are newer than what the chip holds
+	for (i = 0, pRecord = (uint8_t *)pBuffer; i < Count; i++, pRecord += BufferStride)
+		OverlayPending(Address + (i * Stride), pRecord, Size);
+#endif
+}
+
+void EEPROM_ReadRegion(uint16_t Address, void *pBuffer, uint16_t Size)
+{
+	EEPROM_ReadRecords(Address, Size, pBuffer, Size, Size, 1);
+}
+
+void EEPROM_ReadBuffer(uint16_t Address, void *pBuffer, uint8_t Size)
+{
+	EEPROM_ReadRegion(Address, pBuffer, Size);
 }
 
 void EEPROM_WriteBuffer(uint16_t Address, const void *pBuffer)
@@ -44,6 +201,46 @@ void EEPROM_WriteBuffer(uint16_t Address, const void *pBuffer)
 	if (pBuffer == NULL || Address >= 0x2000)
 		return;
 
+#ifdef ENABLE_EEPROM_WRITE_BEHIND
+	if ((Address & 7u) == 0)
+	{	// queue it, EEPROM_Service() writes it out from the main loop
+		const uint16_t        PageAddress = Address & ~(EEPROM_PAGE_SIZE - 1);
+		const unsigned int    Offset      = Address - PageAddress;
+		EEPROM_PendingPage_t *pPage       = FindPage(PageAddress);
+
+		if (pPage == NULL)
+		{
+			uint8_t buffer[EEPROM_PAGE_SIZE];
+
+			EEPROM_ReadBuffer(PageAddress, buffer, sizeof(buffer));
+			if (memcmp(pBuffer, &buffer[Offset], 8) == 0)
+				return;
+
+			if (gEepromQueueCount >= EEPROM_QUEUE_LENGTH)
+			{	// make room
+				WaitReady();
+				if (!WriteOldest())
+					DropOldest();
+			}
+
+			pPage          = &gEepromQueue[gEepromQueueCount++];
+			pPage->Address = PageAddress;
+			pPage->Dirty   = 0;
+			memcpy(pPage->Data, buffer, sizeof(buffer));
+		}
+		else
+		if (memcmp(pBuffer, &pPage->Data[Offset], 8) == 0)
+			return;
+
+		memcpy(&pPage->Data[Offset], pBuffer, 8);
+		pPage->Dirty |= 1u << (Offset / 8);
+
+		gEepromWriteCount++;
+		return;
+	}
+
+	EEPROM_Flush();
+#endif
 
 	uint8_t buffer[8];
 	EEPROM_ReadBuffer(Address, buffer, 8);
@@ -55,8 +252,10 @@ void EEPROM_WriteBuffer(uint16_t Address, const void *pBuffer)
 		I2C_Write((Address >> 0) & 0xFF);
 		I2C_WriteBuffer(pBuffer, 8);
 		I2C_Stop();
-	}
 
-	// give the EEPROM time to burn the data in (apparently takes 5ms)
-	SYSTEM_DelayMs(8);
+		gEepromWriteCount++;
+
+		// give the EEPROM time to burn the data in (apparently takes 5ms)
+		SYSTEM_DelayMs(8);
+	}
 }
@@ -19,8 +19,23 @@
 
 #include <stdint.h>
 
+// bumped on every write that changes the EEPROM, lets RAM copies of EEPROM data know they went stale
+extern uint16_t gEepromWriteCount;
+
 void EEPROM_ReadBuffer(uint16_t Address, void *pBuffer, uint8_t Size);
+
+// whole regions in one I2C transaction, Size can be anything up to the full 8kB
+void EEPROM_ReadRegion(uint16_t Address, void *pBuffer, uint16_t Size);
+
+// Count records of Size bytes, Stride bytes apart in the EEPROM, stored BufferStride bytes apart in pBuffer
+void EEPROM_ReadRecords(uint16_t Address, uint16_t Stride, void *pBuffer, uint16_t BufferStride, uint16_t Size, uint16_t Count);
 void EEPROM_WriteBuffer(uint16_t Address, const void *pBuffer);
 
+#ifdef ENABLE_EEPROM_WRITE_BEHIND
+	// writes go through a small page queue, EEPROM_Service() drains it from the main loop
+	void EEPROM_Service(void);
+	void EEPROM_Flush(void);
+#endif
+
 #endif
 
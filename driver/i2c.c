@@ -20,28 +20,53 @@
 #include "driver/i2c.h"
 #include "driver/systick.h"
 
+#ifdef ENABLE_I2C_FAST_MODE
+	// SCL clock, 400kHz is I2C fast mode. The BL24C64 is also rated for 1MHz (fast mode plus) at 2.5V and up
+	#define I2C_CLOCK_KHZ   400u
+
+	// writing a bit takes 3 delays (data setup, SCL high, SCL low) so each is a third of the clock period,
+	// that gives SCL 2 delays low and 1 high which meets the fast mode low/high times at either clock
+	#define I2C_DELAY_NS    (((1000000u / I2C_CLOCK_KHZ) + 2u) / 3u)
+
+	_Static_assert(SYSTICK_LOOPS_TO_NS(SYSTICK_NS_TO_LOOPS(I2C_DELAY_NS)) >= I2C_DELAY_NS, "I2C delay too short");
+
+	// the EEPROM runs fast, other devices on the bus (the BK1080) keep the standard timing and ACK poll
+	static bool bFastMode = true;
+
+	#define I2C_DELAY()     do { if (bFastMode) SYSTICK_DelayLoops(SYSTICK_NS_TO_LOOPS(I2C_DELAY_NS)); else SYSTICK_DelayUs(1); } while (0)
+#else
+	#define I2C_DELAY()     SYSTICK_DelayUs(1)
+#endif
+
+#ifdef ENABLE_I2C_FAST_MODE
+void I2C_SetFastMode(bool bFast)
+{
+	bFastMode = bFast;
+}
+#endif
+
 void I2C_Start(void)
 {
 	GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_I2C_SDA);
-	SYSTICK_DelayUs(1);
+	I2C_DELAY();
 	GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_I2C_SCL);
-	SYSTICK_DelayUs(1);
+	I2C_DELAY();
 	GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_I2C_SDA);
-	SYSTICK_DelayUs(1);
+	I2C_DELAY();
 	GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_I2C_SCL);
-	SYSTICK_DelayUs(1);
+	I2C_DELAY();
 }
 
 void I2C_Stop(void)
 {
 	GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_I2C_SDA);
-	SYSTICK_DelayUs(1);
+	I2C_DELAY();
 	GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_I2C_SCL);
-	SYSTICK_DelayUs(1);
+	I2C_DELAY();
 	GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_I2C_SCL);
-	SYSTICK_DelayUs(1);
+	I2C_DELAY();
 	GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_I2C_SDA);
-	SYSTICK_DelayUs(1);
+	I2C_DELAY();
 }
 
 uint8_t I2C_Read(bool bFinal)
@@ -55,33 +80,33 @@ uint8_t I2C_Read(bool bFinal)
 	Data = 0;
 	for (i = 0; i < 8; i++) {
 		GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_I2C_SCL);
-		SYSTICK_DelayUs(1);
+		I2C_DELAY();
 		GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_I2C_SCL);
-		SYSTICK_DelayUs(1);
+		I2C_DELAY();
 		Data <<= 1;
-		SYSTICK_DelayUs(1);
+		I2C_DELAY();
 		if (GPIO_CheckBit(&GPIOA->DATA, GPIOA_PIN_I2C_SDA)) {
 			Data |= 1U;
 		}
 		GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_I2C_SCL);
-		SYSTICK_DelayUs(1);
+		I2C_DELAY();
 	}
 
 	PORTCON_PORTA_IE &= ~PORTCON_PORTA_IE_A11_MASK;
 	PORTCON_PORTA_OD |= PORTCON_PORTA_OD_A11_BITS_ENABLE;
 	GPIOA->DIR |= GPIO_DIR_11_BITS_OUTPUT;
 	GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_I2C_SCL);
-	SYSTICK_DelayUs(1);
+	I2C_DELAY();
 	if (bFinal) {
 		GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_I2C_SDA);
 	} else {
 		GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_I2C_SDA);
 	}
-	SYSTICK_DelayUs(1);
+	I2C_DELAY();
 	GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_I2C_SCL);
-	SYSTICK_DelayUs(1);
+	I2C_DELAY();
 	GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_I2C_SCL);
-	SYSTICK_DelayUs(1);
+	I2C_DELAY();
 
 	return Data;
 }
@@ -92,7 +117,7 @@ int I2C_Write(uint8_t Data)
 	int ret = -1;
 
 	GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_I2C_SCL);
-	SYSTICK_DelayUs(1);
+	I2C_DELAY();
 	for (i = 0; i < 8; i++) {
 		if ((Data & 0x80) == 0) {
 			GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_I2C_SDA);
@@ -100,30 +125,40 @@ int I2C_Write(uint8_t Data)
 			GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_I2C_SDA);
 		}
 		Data <<= 1;
-		SYSTICK_DelayUs(1);
+		I2C_DELAY();
 		GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_I2C_SCL);
-		SYSTICK_DelayUs(1);
+		I2C_DELAY();
 		GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_I2C_SCL);
-		SYSTICK_DelayUs(1);
+		I2C_DELAY();
 	}
 
 	PORTCON_PORTA_IE |= PORTCON_PORTA_IE_A11_BITS_ENABLE;
 	PORTCON_PORTA_OD &= ~PORTCON_PORTA_OD_A11_MASK;
 	GPIOA->DIR &= ~GPIO_DIR_11_MASK;
 	GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_I2C_SDA);
-	SYSTICK_DelayUs(1);
+	I2C_DELAY();
 	GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_I2C_SCL);
-	SYSTICK_DelayUs(1);
+	I2C_DELAY();
 
-	for (i = 0; i < 255; i++) {
+#ifdef ENABLE_I2C_FAST_MODE
+	if (bFastMode) {
+		// the EEPROM drives ACK before SCL goes high, one look is enough
 		if (GPIO_CheckBit(&GPIOA->DATA, GPIOA_PIN_I2C_SDA) == 0) {
 			ret = 0;
-			break;
+		}
+	} else
+#endif
+	{
+		for (i = 0; i < 255; i++) {
+			if (GPIO_CheckBit(&GPIOA->DATA, GPIOA_PIN_I2C_SDA) == 0) {
+				ret = 0;
+				break;
+			}
 		}
 	}
 
 	GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_I2C_SCL);
-	SYSTICK_DelayUs(1);
+	I2C_DELAY();
 	PORTCON_PORTA_IE &= ~PORTCON_PORTA_IE_A11_MASK;
 	PORTCON_PORTA_OD |= PORTCON_PORTA_OD_A11_BITS_ENABLE;
 	GPIOA->DIR |= GPIO_DIR_11_BITS_OUTPUT;
@@ -143,11 +178,11 @@ int I2C_ReadBuffer(void *pBuffer, uint8_t Size)
 	}
 
 	for (i = 0; i < Size - 1; i++) {
-		SYSTICK_DelayUs(1);
+		I2C_DELAY();
 		pData[i] = I2C_Read(false);
 	}
 
-	SYSTICK_DelayUs(1);
+	I2C_DELAY();
 	pData[i++] = I2C_Read(true);
 
 	return Size;
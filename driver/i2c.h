@@ -25,6 +25,10 @@ enum {
 	I2C_READ = 1U,
 };
 
+#ifdef ENABLE_I2C_FAST_MODE
+	void I2C_SetFastMode(bool bFast);
+#endif
+
 void I2C_Start(void);
 void I2C_Stop(void);
 
@@ -16,7 +16,11 @@
 
 #include <stdint.h>
 #include <stdio.h>     // NULL
+#include <string.h>
 
+#ifdef ENABLE_LCD_DMA
+	#include "bsp/dp32g030/dma.h"
+#endif
 #include "bsp/dp32g030/gpio.h"
 #include "bsp/dp32g030/spi.h"
 #include "driver/gpio.h"
@@ -26,12 +30,246 @@
 #include "misc.h"
 
 uint8_t gStatusLine[128];
-uint8_t gFrameBuffer[7][128];
+uint8_t gFrameBuffer[7][128] __attribute__((aligned(4)));   // ENABLE_MAIN_WIDGETS hashes it a word at a time
+
+#ifdef ENABLE_UART_SCREENSHOT
+	uint32_t gST7565_BlitCount;
+	uint32_t gST7565_ByteCount;
+#endif
+
+#ifdef ENABLE_LCD_PARTIAL_UPDATE
+	// copy of what the LCD currently shows, so a blit only sends the columns that changed
+	static uint8_t gShadowStatusLine[128];
+	static uint8_t gShadowFrameBuffer[7][128];
+
+	// one bit per LCD page (bit 0 = status line), set when the shadow no longer matches the LCD
+	static uint8_t gShadowInvalid = 0xFF;
+#endif
+
+static void SendLine(const unsigned int Line, const unsigned int Column, const uint8_t *pData, const unsigned int Size)
+{
+	unsigned int i;
+
+	ST7565_SelectColumnAndLine(Column + 4U, Line);
+
+	GPIO_SetBit(&GPIOB->DATA, GPIOB_PIN_ST7565_A0);
+
+	for (i = 0; i < Size; i++)
+	{
+		while ((SPI0->FIFOST & SPI_FIFOST_TFF_MASK) != SPI_FIFOST_TFF_BITS_NOT_FULL) {}
+		SPI0->WDR = pData[i];
+	}
+
+	SPI_WaitForUndocumentedTxFifoStatusBit();
+}
+
+#ifdef ENABLE_LCD_DMA
+	// DMA_CH0 belongs to the UART RX, the LCD streams out on DMA_CH1
+	#define ST7565_DMA_CH             DMA_CH1
+	#define ST7565_DMA_TC_INTST_MASK  DMA_INTST_CH1_TC_INTST_MASK
+	#define ST7565_DMA_TC_INTST_SET   DMA_INTST_CH1_TC_INTST_BITS_SET
+	// SPI0 TX handshake request line
+	#define ST7565_DMA_MD_SEL         DMA_CH_MOD_MD_SEL_BITS_HSREQ_MS0
+
+	typedef struct {
+		const uint8_t *pData;     // points into the shadow buffer, which stays untouched until the queue is empty
+		uint8_t        Line;
+		uint8_t        Column;
+		uint8_t        Size;
+	} DMA_LineWrite_t;
+
+	static DMA_LineWrite_t gDmaQueue[8];
+	static uint8_t         gDmaQueueCount;
+	static uint8_t         gDmaQueueIndex;
+	static bool            gDmaQueuing;
+
+	// completion flag, cleared once the last queued line has left the SPI FIFO
+	static volatile bool   gDmaBusy;
+
+	static void StartNextDmaLine(void)
+	{
+		const DMA_LineWrite_t *pWrite;
+
+		if (gDmaQueueIndex >= gDmaQueueCount)
+		{	// all done
+			SPI0->CR &= ~SPI_CR_TXDMAEN_MASK;
+			SPI_ToggleMasterMode(&SPI0->CR, true);
+			gDmaBusy = false;
+			return;
+		}
+
+		pWrite = &gDmaQueue[gDmaQueueIndex++];
+
+		// the column/line command bytes go out the old way, A0 must not change while the DMA is running
+		SPI0->CR &= ~SPI_CR_TXDMAEN_MASK;
+		ST7565_SelectColumnAndLine(pWrite->Column + 4U, pWrite->Line);
+		GPIO_SetBit(&GPIOB->DATA, GPIOB_PIN_ST7565_A0);
+
+		DMA_CTR = (DMA_CTR & ~DMA_CTR_DMAEN_MASK) | DMA_CTR_DMAEN_BITS_ENABLE;
+
+		ST7565_DMA_CH->CTR    = 0;
+		DMA_INTST             = ST7565_DMA_TC_INTST_SET;
+		ST7565_DMA_CH->MSADDR = (uint32_t)(uintptr_t)pWrite->pData;
+		ST7565_DMA_CH->MDADDR = (uint32_t)(uintptr_t)&SPI0->WDR;
+		ST7565_DMA_CH->MOD    = 0
+			// Source
+			| DMA_CH_MOD_MS_ADDMOD_BITS_INCREMENT
+			| DMA_CH_MOD_MS_SIZE_BITS_8BIT
+			| DMA_CH_MOD_MS_SEL_BITS_SRAM
+			// Destination
+			| DMA_CH_MOD_MD_ADDMOD_BITS_NONE
+			| DMA_CH_MOD_MD_SIZE_BITS_8BIT
+			| ST7565_DMA_MD_SEL
+			;
+		ST7565_DMA_CH->CTR    = 0
+			| DMA_CH_CTR_CH_EN_BITS_ENABLE
+			| (((pWrite->Size - 1U) << DMA_CH_CTR_LENGTH_SHIFT) & DMA_CH_CTR_LENGTH_MASK)
+			| DMA_CH_CTR_LOOP_BITS_DISABLE
+			| DMA_CH_CTR_PRI_BITS_LOW
+			;
+
+		SPI0->CR |= SPI_CR_TXDMAEN_MASK;
+	}
+
+	void ST7565_ServiceDma(void)
+	{
+		if (!gDmaBusy)
+			return;
+
+		if ((DMA_INTST & ST7565_DMA_TC_INTST_MASK) == 0)
+			return;   // DMA still feeding the FIFO
+
+		if (SPI0->IF & 0x20)
+			return;   // last bytes still shifting out (same undocumented bit SPI_WaitForUndocumentedTxFifoStatusBit() polls)
+
+		ST7565_DMA_CH->CTR = 0;
+		DMA_INTST          = ST7565_DMA_TC_INTST_SET;
+
+		StartNextDmaLine();
+	}
+
+	void ST7565_WaitForDma(void)
+	{
+		while (gDmaBusy)
+			ST7565_ServiceDma();
+	}
+
+	bool ST7565_IsDmaBusy(void)
+	{
+		return gDmaBusy;
+	}
+#endif
+
+static void BlitLine(const unsigned int Line)
+{
+	const uint8_t *pLine = (Line == 0) ? gStatusLine : gFrameBuffer[Line - 1];
+
+#ifdef ENABLE_LCD_PARTIAL_UPDATE
+	uint8_t       *pShadow = (Line == 0) ? gShadowStatusLine : gShadowFrameBuffer[Line - 1];
+	unsigned int   First   = 0;
+	unsigned int   Last    = LCD_WIDTH;
+
+	if ((gShadowInvalid & (1u << Line)) == 0)
+	{	// only send the span between the first and last changed column
+		while (First < LCD_WIDTH && pLine[First] == pShadow[First])
+			First++;
+
+		if (First >= LCD_WIDTH)
+			return;   // nothing changed on this line
+
+		while (pLine[Last - 1] == pShadow[Last - 1])
+			Last--;
+	}
+
+	gShadowInvalid &= ~(1u << Line);
+
+	memcpy(pShadow + First, pLine + First, Last - First);
+
+	#ifdef ENABLE_UART_SCREENSHOT
+		gST7565_ByteCount += Last - First;
+	#endif
+
+	#ifdef ENABLE_LCD_DMA
+		if (gDmaQueuing)
+		{
+			DMA_LineWrite_t *pWrite = &gDmaQueue[gDmaQueueCount++];
+			pWrite->pData  = pShadow + First;
+			pWrite->Line   = Line;
+			pWrite->Column = First;
+			pWrite->Size   = Last - First;
+			return;
+		}
+	#endif
+
+	SendLine(Line, First, pLine + First, Last - First);
+#else
+	#ifdef ENABLE_UART_SCREENSHOT
+		gST7565_ByteCount += LCD_WIDTH;
+	#endif
+
+	SendLine(Line, 0, pLine, LCD_WIDTH);
+#endif
+}
+
+static void BlitLines(const unsigned int FirstLine, const unsigned int LastLine)
+{
+	unsigned int Line;
+
+#ifdef ENABLE_UART_SCREENSHOT
+	gST7565_BlitCount++;
+#endif
+
+#ifdef ENABLE_LCD_DMA
+	{	// stream the lines out in the background, or fall back to polling if the previous blit is still going.
+		// The previous queue has to run out before it's reset, its lines are already in the shadow buffer
+		const bool bWasBusy = gDmaBusy;
+
+		ST7565_WaitForDma();
+
+		gDmaQueueCount = 0;
+		gDmaQueueIndex = 0;
+		gDmaQueuing    = !bWasBusy;
+	}
+#endif
+
+	SPI_ToggleMasterMode(&SPI0->CR, false);
+
+	ST7565_WriteByte(0x40);    // start line 0
+
+	for (Line = FirstLine; Line <= LastLine; Line++)
+		BlitLine(Line);
+
+#ifdef ENABLE_LCD_DMA
+	if (gDmaQueuing)
+	{
+		gDmaQueuing = false;
+		if (gDmaQueueCount > 0)
+		{	// chip select stays active until StartNextDmaLine() runs out of lines
+			gDmaBusy = true;
+			StartNextDmaLine();
+			return;
+		}
+	}
+#endif
+
+	SPI_ToggleMasterMode(&SPI0->CR, true);
+}
+
+void ST7565_InvalidateScreen(void)
+{
+#ifdef ENABLE_LCD_PARTIAL_UPDATE
+	gShadowInvalid = 0xFF;
+#endif
+}
 
 void ST7565_DrawLine(const unsigned int Column, const unsigned int Line, const unsigned int Size, const uint8_t *pBitmap)
 {
 	unsigned int i;
 
+#ifdef ENABLE_LCD_DMA
+	ST7565_WaitForDma();
+#endif
+
 	SPI_ToggleMasterMode(&SPI0->CR, false);
 
 	ST7565_SelectColumnAndLine(Column + 4U, Line);
@@ -58,28 +296,21 @@ void ST7565_DrawLine(const unsigned int Column, const unsigned int Line, const u
 	SPI_WaitForUndocumentedTxFifoStatusBit();
 
 	SPI_ToggleMasterMode(&SPI0->CR, true);
+
+#ifdef ENABLE_UART_SCREENSHOT
+	gST7565_ByteCount += Size;
+#endif
+
+#ifdef ENABLE_LCD_PARTIAL_UPDATE
+	// drawn behind the frame buffers back, the next blit has to resend this line
+	if (Line < 8)
+		gShadowInvalid |= 1u << Line;
+#endif
 }
 
 void ST7565_BlitFullScreen(void)
 {
-	unsigned int Line;
-
-	SPI_ToggleMasterMode(&SPI0->CR, false);
-
-	ST7565_WriteByte(0x40);
-
-	for (Line = 0; Line < ARRAY_SIZE(gFrameBuffer); Line++)
-	{
-		unsigned int Column;
-		ST7565_SelectColumnAndLine(4, Line + 1);
-		GPIO_SetBit(&GPIOB->DATA, GPIOB_PIN_ST7565_A0);
-		for (Column = 0; Column < ARRAY_SIZE(gFrameBuffer[0]); Column++)
-		{
-			while ((SPI0->FIFOST & SPI_FIFOST_TFF_MASK) != SPI_FIFOST_TFF_BITS_NOT_FULL) {}
-			SPI0->WDR = gFrameBuffer[Line][Column];
-		}
-		SPI_WaitForUndocumentedTxFifoStatusBit();
-	}
+	BlitLines(1, ARRAY_SIZE(gFrameBuffer));
 
 	#if 0
 		// whats the delay for I wonder, it holds things up :(
@@ -87,32 +318,11 @@ void ST7565_BlitFullScreen(void)
 	#else
 //		SYSTEM_DelayMs(1);
 	#endif
-
-	SPI_ToggleMasterMode(&SPI0->CR, true);
 }
 
 void ST7565_BlitStatusLine(void)
 {	// the top small text line on the display
-
-	unsigned int i;
-
-	SPI_ToggleMasterMode(&SPI0->CR, false);
-
-	ST7565_WriteByte(0x40);    // start line ?
-
-	ST7565_SelectColumnAndLine(4, 0);
-
-	GPIO_SetBit(&GPIOB->DATA, GPIOB_PIN_ST7565_A0);
-
-	for (i = 0; i < ARRAY_SIZE(gStatusLine); i++)
-	{
-		while ((SPI0->FIFOST & SPI_FIFOST_TFF_MASK) != SPI_FIFOST_TFF_BITS_NOT_FULL) {}
-		SPI0->WDR = gStatusLine[i];
-	}
-
-	SPI_WaitForUndocumentedTxFifoStatusBit();
-
-	SPI_ToggleMasterMode(&SPI0->CR, true);
+	BlitLines(0, 0);
 }
 
 void ST7565_FillScreen(uint8_t Value)
@@ -138,6 +348,12 @@ void ST7565_FillScreen(uint8_t Value)
 	}
 
 	SPI_ToggleMasterMode(&SPI0->CR, true);
+
+#ifdef ENABLE_UART_SCREENSHOT
+	gST7565_ByteCount += 8 * 132;
+#endif
+
+	ST7565_InvalidateScreen();
 }
 
 // Software reset
@@ -207,6 +423,10 @@ uint8_t cmds[] = {
 
 void ST7565_Init(const bool full)
 {
+#ifdef ENABLE_LCD_DMA
+	ST7565_WaitForDma();
+#endif
+
 	if (full) {
 		SPI0_Init();
 		ST7565_HardwareReset();
@@ -243,11 +463,30 @@ void ST7565_Init(const bool full)
 
 void ST7565_FixInterfGlitch(void)
 {
+#ifdef ENABLE_LCD_DMA
+	ST7565_WaitForDma();
+#endif
+
 	SPI_ToggleMasterMode(&SPI0->CR, false);
 	for(uint8_t i = 0; i < ARRAY_SIZE(cmds); i++)
 		ST7565_WriteByte(cmds[i]);
 	SPI_WaitForUndocumentedTxFifoStatusBit();
 	SPI_ToggleMasterMode(&SPI0->CR, true);
+
+	// the display RAM may have been corrupted as well, repaint everything on the next blit
+	ST7565_InvalidateScreen();
+}
+
+void ST7565_SetStartLine(uint8_t Line)
+{	// scrolls the whole display in hardware, the next blit sets it back to line 0
+#ifdef ENABLE_LCD_DMA
+	ST7565_WaitForDma();
+#endif
+
+	SPI_ToggleMasterMode(&SPI0->CR, false);
+	ST7565_WriteByte(ST7565_CMD_SET_START_LINE | (Line & 63u));
+	SPI_WaitForUndocumentedTxFifoStatusBit();
+	SPI_ToggleMasterMode(&SPI0->CR, true);
 }
 
 void ST7565_HardwareReset(void)
@@ -26,15 +26,27 @@
 extern uint8_t gStatusLine[128];
 extern uint8_t gFrameBuffer[7][128];
 
+#ifdef ENABLE_UART_SCREENSHOT
+	extern uint32_t gST7565_BlitCount;   // number of full screen/status line blits
+	extern uint32_t gST7565_ByteCount;   // display data bytes sent to the LCD
+#endif
+
 void ST7565_DrawLine(const unsigned int Column, const unsigned int Line, const unsigned int Size, const uint8_t *pBitmap);
 void ST7565_BlitFullScreen(void);
 void ST7565_BlitStatusLine(void);
 void ST7565_FillScreen(uint8_t Value);
+void ST7565_InvalidateScreen(void);
 void ST7565_Init(const bool full);
 void ST7565_FixInterfGlitch(void);
+void ST7565_SetStartLine(uint8_t Line);
 void ST7565_HardwareReset(void);
 void ST7565_SelectColumnAndLine(uint8_t Column, uint8_t Line);
 void ST7565_WriteByte(uint8_t Value);
+#ifdef ENABLE_LCD_DMA
+	void ST7565_ServiceDma(void);
+	void ST7565_WaitForDma(void);
+	bool ST7565_IsDmaBusy(void);
+#endif
 
 #endif
 
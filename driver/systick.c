@@ -23,7 +23,7 @@ static uint32_t gTickMultiplier;
 
 void SYSTICK_Init(void)
 {
-	SysTick_Config(480000);
+	SysTick_Config(SYSTICK_TICK_US * SYSTICK_CPU_MHZ);
 	gTickMultiplier = 48;
 }
 
@@ -31,13 +31,21 @@ void SYSTICK_DelayUs(uint32_t Delay)
 {
 	const uint32_t ticks    = Delay * gTickMultiplier;
 	uint32_t       i        = 0;
-	uint32_t       Start    = SysTick->LOAD;
+	#ifndef ENABLE_TICKLESS_IDLE
+		uint32_t   Start    = SysTick->LOAD;
+	#endif
 	uint32_t       Previous = SysTick->VAL;
 	do {
 		uint32_t Current;
 		uint32_t Delta;
 		while ((Current = SysTick->VAL) == Previous) {}
-		Delta    = (Current < Previous) ? -Current : Start - Current;
+		#ifdef ENABLE_TICKLESS_IDLE
+			// LOAD may hold the period after the one the counter reloaded with,
+			// so count nothing past the reload, the delay can only come out a little longer
+			Delta    = (Current < Previous) ? -Current : 0;
+		#else
+			Delta    = (Current < Previous) ? -Current : Start - Current;
+		#endif
 		i       += Delta + Previous;
 		Previous = Current;
 	} while (i < ticks);
@@ -19,8 +19,37 @@
 
 #include <stdint.h>
 
+#define SYSTICK_CPU_MHZ   48u
+
+#ifdef ENABLE_BK4819_IRQ_QUEUE
+	#define SYSTICK_TICK_US   1000u    // SystickHandler() divides it back down to 10ms
+#else
+	#define SYSTICK_TICK_US   10000u
+#endif
+
+// SYSTICK_DelayLoops() takes (4 * loops) - 2 CPU cycles on the Cortex-M0 (subs 1, taken bne 3, last bne 1),
+// rounded up so it's never 0 loops
+#define SYSTICK_NS_TO_LOOPS(ns)      (((((ns) * SYSTICK_CPU_MHZ) + 2000u) + 3999u) / 4000u)
+#define SYSTICK_LOOPS_TO_NS(loops)   ((((loops) * 4u) - 2u) * 1000u / SYSTICK_CPU_MHZ)
+
+#define SYSTICK_NS_TO_CYCLES(ns)     ((((ns) * SYSTICK_CPU_MHZ) + 999u) / 1000u)
+
+// straight-line busy wait, a compile time constant number of CPU cycles as one nop each
+#define SYSTICK_DELAY_CYCLES(cycles) __asm volatile (".rept %c0\n\tnop\n\t.endr" : : "i" (cycles))
+
 void SYSTICK_Init(void);
 void SYSTICK_DelayUs(uint32_t Delay);
 
+// sub-microsecond busy wait for the bit-banged buses
+static inline __attribute__((always_inline)) void SYSTICK_DelayLoops(uint32_t Loops)
+{
+	__asm volatile (
+		"1:	subs %0, %0, #1\n"
+		"	bne  1b\n"
+		: "+l" (Loops)
+		:
+		: "cc");
+}
+
 #endif
 
@@ -23,6 +23,432 @@
 
 const char *CNList = "忙池机节解码消失恢复立即停止侧菜单样式扰释放所有按键静噪等级长短以锁广播频率开关禁收发射超时亚音功背光步进上下差尾模信道保存删除名字称显示压声储带宽窄低中高主动态跨段双守皆响铃回答电量分钟秒文无方向话筒屏语重置阿波罗全昆达令息手灯监听扫描警告盘定切换控败呼叫来自拨号成线制报占就绪完拟数";
 
+// UTF-8 sequence << 8 | glyph index, sorted - generated by utils/main.cpp from CNList
+const uint32_t CNIndex[] =
+{
+	0xE4B88A35,   // 上 53
+	0xE4B88B36,   // 下 54
+	0xE4B8AD4C,   // 中 76
+	0xE4B8BB4E,   // 主 78
+	0xE4BA9A2E,   // 亚 46
+	0xE4BBA46F,   // 令 111
+	0xE4BBA520,   // 以 32
+	0xE4BD8E4B,   // 低 75
+	0xE4BEA70E,   // 侧 14
+	0xE4BF9D3C,   // 保 60
+	0xE4BFA13A,   // 信 58
+	0xE5819C0C,   // 停 12
+	0xE582A847,   // 储 71
+	0xE5858932,   // 光 50
+	0xE585A86C,   // 全 108
+	0xE585B327,   // 关 39
+	0xE588865C,   // 分 92
+	0xE588877B,   // 切 123
+	0xE588A03E,   // 删 62
+	0xE588B687,   // 制 135
+	0xE58A9F30,   // 功 48
+	0xE58AA84F,   // 动 79
+	0xE58D9510,   // 单 16
+	0xE58DA089,   // 占 137
+	0xE58DB30B,   // 即 11
+	0xE58E8B45,   // 压 69
+	0xE58F8C53,   // 双 83
+	0xE58F912A,   // 发 42
+	0xE58FAB80,   // 叫 128
+	0xE58FB784,   // 号 132
+	0xE5908D40,   // 名 64
+	0xE5909162,   // 向 98
+	0xE590AC74,   // 听 116
+	0xE5918A78,   // 告 120
+	0xE591BC7F,   // 呼 127
+	0xE5938D56,   // 响 86
+	0xE599AA1B,   // 噪 27
+	0xE59B9E58,   // 回 88
+	0xE5A3B046,   // 声 70
+	0xE5A48D09,   // 复 9
+	0xE5A4B107,   // 失 7
+	0xE5AD9741,   // 字 65
+	0xE5AD983D,   // 存 61
+	0xE5AE8854,   // 守 84
+	0xE5AE8C8C,   // 完 140
+	0xE5AE9A7A,   // 定 122
+	0xE5AEBD49,   // 宽 73
+	0xE5B0842B,   // 射 43
+	0xE5B0B18A,   // 就 138
+	0xE5B0BE38,   // 尾 56
+	0xE5B18F65,   // 屏 101
+	0xE5B7AE37,   // 差 55
+	0xE5B8A648,   // 带 72
+	0xE5B9BF22,   // 广 34
+	0xE5BC8026,   // 开 38
+	0xE5BC8F12,   // 式 18
+	0xE5BF9900,   // 忙 0
+	0xE6808150,   // 态 80
+	0xE681A208,   // 恢 8
+	0xE681AF70,   // 息 112
+	0xE6889085,   // 成 133
+	0xE6898016,   // 所 22
+	0xE6898B71,   // 手 113
+	0xE689AB75,   // 扫 117
+	0xE689B013,   // 扰 19
+	0xE68AA588,   // 报 136
+	0xE68B9F8D,   // 拟 141
+	0xE68BA883,   // 拨 131
+	0xE68C8918,   // 按 24
+	0xE68DA27C,   // 换 124
+	0xE68EA77D,   // 控 125
+	0xE68F8F76,   // 描 118
+	0xE692AD23,   // 播 35
+	0xE694B629,   // 收 41
+	0xE694BE15,   // 放 21
+	0xE695B08E,   // 数 142
+	0xE696875F,   // 文 95
+	0xE696B961,   // 方 97
+	0xE697A060,   // 无 96
+	0xE697B62D,   // 时 45
+	0xE698866D,   // 昆 109
+	0xE698BE43,   // 显 67
+	0xE69C8917,   // 有 23
+	0xE69CBA02,   // 机 2
+	0xE69DA581,   // 来 129
+	0xE6A0B711,   // 样 17
+	0xE6A8A139,   // 模 57
+	0xE6ADA20D,   // 止 13
+	0xE6ADA533,   // 步 51
+	0xE6AEB552,   // 段 82
+	0xE6B1A001,   // 池 1
+	0xE6B3A26A,   // 波 106
+	0xE6B68806,   // 消 6
+	0xE781AF72,   // 灯 114
+	0xE78E8725,   // 率 37
+	0xE794B55A,   // 电 90
+	0xE79A8655,   // 皆 85
+	0xE79B9173,   // 监 115
+	0xE79B9879,   // 盘 121
+	0xE79FAD1F,   // 短 31
+	0xE7A08105,   // 码 5
+	0xE7A4BA44,   // 示 68
+	0xE7A68128,   // 禁 40
+	0xE7A7925E,   // 秒 94
+	0xE7A7B042,   // 称 66
+	0xE7AA844A,   // 窄 74
+	0xE7AB8B0A,   // 立 10
+	0xE7AD891C,   // 等 28
+	0xE7AD9264,   // 筒 100
+	0xE7AD9459,   // 答 89
+	0xE7BAA71D,   // 级 29
+	0xE7BABF86,   // 线 134
+	0xE7BBAA8B,   // 绪 139
+	0xE7BD976B,   // 罗 107
+	0xE7BDAE68,   // 置 104
+	0xE8838C31,   // 背 49
+	0xE887AA82,   // 自 130
+	0xE88A8203,   // 节 3
+	0xE88F9C0F,   // 菜 15
+	0xE8A7A304,   // 解 4
+	0xE8ADA677,   // 警 119
+	0xE8AF9D63,   // 话 99
+	0xE8AFAD66,   // 语 102
+	0xE8B4A57E,   // 败 126
+	0xE8B6852C,   // 超 44
+	0xE8B7A851,   // 跨 81
+	0xE8BEBE6E,   // 达 110
+	0xE8BF9B34,   // 进 52
+	0xE981933B,   // 道 59
+	0xE9878A14,   // 释 20
+	0xE9878D67,   // 重 103
+	0xE9878F5B,   // 量 91
+	0xE9929F5D,   // 钟 93
+	0xE9938357,   // 铃 87
+	0xE9948121,   // 锁 33
+	0xE994AE19,   // 键 25
+	0xE995BF1E,   // 长 30
+	0xE998BF69,   // 阿 105
+	0xE999A43F,   // 除 63
+	0xE99D991A,   // 静 26
+	0xE99FB32F,   // 音 47
+	0xE9A29124,   // 频 36
+	0xE9AB984D,   // 高 77
+};
+
+const unsigned int CNIndexCount = sizeof(CNIndex) / sizeof(CNIndex[0]);
+
+#ifdef ENABLE_PACKED_CN_FONT
+
+// 143 glyphs, 14 x 14 pixels, 3504 bytes (4004 unpacked) - generated by utils/main.cpp from CNFont14[]
+const uint8_t CNFont14Packed[] =
+{
+	0xF0, 0x00, 0x00, 0xF0, 0xFF, 0x43, 0x00, 0x20, 0x00, 0x04, 0x00, 0xFF, 0x43, 0x80, 0x11, 0xA0,
+	0x05, 0x08, 0x01, 0x42, 0x80, 0x10, 0x20, 0x00, 0x00, 0x02, 0x08, 0x61, 0x04, 0x06, 0x62, 0x00,
+	0x02, 0xF0, 0x7F, 0x20, 0x20, 0x04, 0xF8, 0x7F, 0x42, 0x80, 0x08, 0x22, 0xFF, 0x08, 0x80, 0x03,
+	0x00, 0x08, 0x01, 0x32, 0xF0, 0xFF, 0x23, 0x01, 0x88, 0x20, 0x00, 0xE6, 0x7F, 0x08, 0x00, 0x02,
+	0x80, 0x00, 0xE0, 0xFF, 0x01, 0x80, 0x00, 0x38, 0x00, 0x40, 0x00, 0x10, 0x01, 0x44, 0xC0, 0x17,
+	0x40, 0x04, 0x10, 0xFF, 0x44, 0x00, 0x11, 0x40, 0x04, 0x7C, 0x21, 0x44, 0x08, 0xF1, 0x41, 0x00,
+	0x00, 0x00, 0x08, 0x20, 0xFD, 0x37, 0x49, 0xE8, 0x7F, 0x96, 0x24, 0xFC, 0x0F, 0x50, 0x48, 0x13,
+	0x8E, 0x84, 0xF8, 0x2F, 0x49, 0x78, 0x12, 0x00, 0x04, 0x00, 0x40, 0x08, 0x90, 0x7F, 0x5C, 0x08,
+	0x11, 0x42, 0xFC, 0x09, 0x08, 0x7A, 0x82, 0x90, 0x20, 0x24, 0x08, 0x09, 0x7E, 0x22, 0x10, 0x08,
+	0xFC, 0x01, 0x00, 0x20, 0x80, 0x10, 0x46, 0x60, 0x20, 0x06, 0x00, 0x80, 0xFC, 0x4F, 0x49, 0x40,
+	0x12, 0x9F, 0x04, 0x24, 0x49, 0x49, 0xCA, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x08, 0x82, 0x82, 0x90,
+	0x90, 0x23, 0x82, 0x48, 0x20, 0x0E, 0xFF, 0x00, 0xE2, 0x80, 0x48, 0x20, 0x22, 0x88, 0x10, 0x20,
+	0x08, 0x08, 0x02, 0x00, 0x70, 0x00, 0x00, 0xF0, 0xFF, 0x23, 0x00, 0x10, 0x01, 0x22, 0x88, 0x26,
+	0x61, 0x26, 0x0F, 0x06, 0x7A, 0x80, 0x60, 0x20, 0x64, 0xC8, 0x20, 0x00, 0x00, 0x01, 0x22, 0x90,
+	0x04, 0xE4, 0xBE, 0xA4, 0x7A, 0xA9, 0x2A, 0xAA, 0x8A, 0xAA, 0xA2, 0x6A, 0xA9, 0x5A, 0xFA, 0xA2,
+	0x00, 0x28, 0x00, 0x02, 0x00, 0x00, 0x20, 0x02, 0x88, 0x08, 0x22, 0x8C, 0x08, 0x6C, 0x02, 0xA8,
+	0x00, 0x22, 0xC0, 0x08, 0x2C, 0xC2, 0x88, 0x0C, 0x22, 0x80, 0x00, 0x20, 0x00, 0xE0, 0xFF, 0x49,
+	0x22, 0x92, 0x85, 0xA4, 0x20, 0x49, 0xF8, 0x23, 0x00, 0x80, 0xFF, 0x2F, 0x00, 0x08, 0x00, 0x02,
+	0x84, 0x00, 0xE1, 0x7F, 0x00, 0x00, 0x40, 0x00, 0x08, 0x80, 0xFF, 0x1F, 0x00, 0x82, 0x81, 0xAE,
+	0xA0, 0x2A, 0xA8, 0x8A, 0xAB, 0xA2, 0xAA, 0xAF, 0x2A, 0xE8, 0x0A, 0x82, 0x01, 0x00, 0x00, 0x00,
+	0x02, 0x80, 0x00, 0x20, 0xFE, 0x0F, 0x00, 0x02, 0x80, 0x00, 0xE0, 0xFF, 0x0F, 0x02, 0x82, 0x80,
+	0x20, 0x20, 0x08, 0x08, 0x00, 0x02, 0x00, 0x20, 0x00, 0x04, 0xC0, 0xFF, 0x0F, 0x00, 0xFE, 0xA3,
+	0x00, 0xA6, 0x7F, 0x08, 0x20, 0xFE, 0x13, 0x00, 0x80, 0x3F, 0x02, 0x80, 0xFF, 0x3F, 0x00, 0x20,
+	0x10, 0x49, 0x44, 0x32, 0xC9, 0x55, 0x22, 0x51, 0xC8, 0x0C, 0xD2, 0xBF, 0xC4, 0xA0, 0x50, 0x3C,
+	0x25, 0x3A, 0x89, 0x42, 0x24, 0x10, 0x01, 0x00, 0x00, 0x08, 0x00, 0xC2, 0x9F, 0x94, 0x24, 0x26,
+	0x09, 0x49, 0xC2, 0xFF, 0x93, 0x24, 0x26, 0x49, 0x49, 0xC2, 0x9F, 0x00, 0x20, 0x00, 0x08, 0x00,
+	0x80, 0x10, 0x20, 0x03, 0xFF, 0x3F, 0x12, 0x00, 0x28, 0x24, 0x09, 0x4A, 0x02, 0x92, 0x80, 0xFF,
+	0x23, 0x09, 0x4A, 0x42, 0x92, 0x00, 0x20, 0x00, 0x00, 0x08, 0x10, 0x12, 0x84, 0x04, 0x21, 0x7F,
+	0x48, 0x08, 0x12, 0x82, 0x80, 0x20, 0x00, 0xFF, 0x01, 0x82, 0x91, 0x80, 0x28, 0x40, 0x08, 0x3C,
+	0x00, 0x80, 0x10, 0x22, 0x84, 0xFF, 0x3F, 0x22, 0x80, 0x04, 0x42, 0x40, 0x10, 0xCC, 0xFF, 0x00,
+	0x01, 0xC0, 0x7F, 0x12, 0x20, 0x05, 0x08, 0x81, 0x03, 0x00, 0x48, 0x90, 0x14, 0x23, 0x34, 0xF8,
+	0xFF, 0x51, 0x41, 0x92, 0x20, 0x80, 0x18, 0x25, 0x2A, 0x89, 0xE4, 0xAF, 0x92, 0x18, 0x25, 0x40,
+	0x08, 0x00, 0x80, 0x00, 0x22, 0x60, 0xF9, 0x87, 0x12, 0x88, 0x04, 0x22, 0x7F, 0x20, 0x20, 0x04,
+	0xF4, 0xBE, 0x20, 0x10, 0x08, 0x0B, 0x3E, 0x84, 0x00, 0x02, 0x00, 0x00, 0xA0, 0xFF, 0x27, 0x11,
+	0x48, 0x04, 0x11, 0x41, 0x7C, 0x08, 0x00, 0xF9, 0x3F, 0x22, 0x80, 0x08, 0x10, 0xFE, 0x87, 0x00,
+	0x20, 0x00, 0x00, 0x40, 0x08, 0x10, 0x01, 0x24, 0x00, 0xFD, 0xCF, 0x49, 0x5C, 0x12, 0x94, 0x04,
+	0x25, 0x41, 0x49, 0x52, 0x92, 0xF4, 0x3F, 0x01, 0x40, 0x00, 0x00, 0x00, 0x08, 0x21, 0x42, 0xF8,
+	0xFF, 0x23, 0x02, 0x00, 0x00, 0x17, 0x48, 0x24, 0x12, 0x4F, 0x75, 0x8C, 0x11, 0x41, 0xA4, 0x10,
+	0x47, 0x5C, 0x20, 0x00, 0x00, 0x11, 0xA0, 0x04, 0xE7, 0x1F, 0x49, 0x0A, 0x40, 0x91, 0x21, 0xDC,
+	0x17, 0x04, 0x44, 0x55, 0xFE, 0xFF, 0x54, 0x25, 0x5F, 0x09, 0x41, 0x02, 0x00, 0xAA, 0xBF, 0xAA,
+	0xF2, 0xAB, 0xA8, 0xAA, 0xAA, 0x3F, 0x02, 0x40, 0x49, 0x4E, 0x92, 0xF2, 0xBF, 0x26, 0x61, 0x49,
+	0xC0, 0x3F, 0x80, 0x00, 0x00, 0xC0, 0x7F, 0x10, 0x08, 0xFC, 0x07, 0x00, 0x00, 0x20, 0xC1, 0x49,
+	0x57, 0x4A, 0x9D, 0x51, 0xF0, 0xD7, 0x19, 0x57, 0x0A, 0x9C, 0x04, 0x20, 0x01, 0x00, 0x88, 0x00,
+	0xA1, 0x30, 0x2A, 0x98, 0x2A, 0xAA, 0x92, 0xA8, 0x80, 0x2F, 0x92, 0x8A, 0xA3, 0xBF, 0xA8, 0x60,
+	0x2A, 0x28, 0x0A, 0x82, 0x00, 0x00, 0x80, 0x19, 0x51, 0x45, 0x33, 0x09, 0x46, 0x02, 0x00, 0x0A,
+	0x60, 0xFE, 0x87, 0x80, 0x28, 0x46, 0x49, 0x21, 0x4E, 0x16, 0x70, 0x08, 0x00, 0x02, 0x00, 0x40,
+	0x00, 0x10, 0x00, 0x04, 0xFC, 0xFF, 0x40, 0x10, 0x10, 0x02, 0x0D, 0x20, 0x05, 0x44, 0x82, 0x10,
+	0x11, 0x84, 0x00, 0x41, 0x40, 0x10, 0x00, 0x80, 0x08, 0x1E, 0x72, 0xFC, 0x03, 0x21, 0x41, 0x88,
+	0x01, 0x80, 0xF2, 0xA5, 0x44, 0x2A, 0x11, 0x4A, 0x84, 0x12, 0xA9, 0x7C, 0x09, 0x00, 0x02, 0x00,
+	0xFE, 0x0F, 0x00, 0x01, 0x20, 0x06, 0x84, 0x02, 0x10, 0x03, 0x04, 0x80, 0x00, 0x10, 0x00, 0xC3,
+	0x3F, 0x00, 0x20, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x11, 0xA0, 0x04, 0xE7, 0x3F, 0x49, 0x44,
+	0x92, 0x00, 0x80, 0xF2, 0x27, 0x05, 0x04, 0x81, 0x7C, 0x1F, 0x10, 0x08, 0x05, 0x24, 0x7F, 0x02,
+	0x00, 0x00, 0x20, 0x00, 0xC6, 0x7F, 0x10, 0x00, 0x04, 0x00, 0x01, 0x50, 0x00, 0x18, 0x00, 0x04,
+	0x00, 0x01, 0x40, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x80, 0x10, 0x22, 0x82, 0xFF, 0x3F, 0x12,
+	0x20, 0x08, 0x58, 0xFD, 0x3A, 0x95, 0x44, 0xE5, 0xF7, 0x45, 0x54, 0x39, 0x55, 0xD5, 0x0F, 0x08,
+	0x00, 0x00, 0x20, 0x22, 0x4F, 0x08, 0x02, 0xFD, 0x2E, 0x24, 0x04, 0xC9, 0x20, 0x00, 0xCA, 0x5F,
+	0x1A, 0x88, 0xF5, 0x21, 0x81, 0xC8, 0xDF, 0x02, 0x00, 0x00, 0x00, 0x51, 0x90, 0x12, 0x44, 0x04,
+	0x01, 0x41, 0x52, 0xD4, 0x16, 0x6E, 0x3F, 0x49, 0x41, 0x59, 0x10, 0x1C, 0x44, 0x04, 0x29, 0x01,
+	0x51, 0x00, 0x00, 0x40, 0x60, 0x10, 0x14, 0xC4, 0xFC, 0x0F, 0x41, 0x40, 0x10, 0x10, 0x04, 0x04,
+	0x01, 0x41, 0xC0, 0xFF, 0x1F, 0x04, 0x04, 0x01, 0x40, 0x00, 0x00, 0x00, 0x08, 0x22, 0x82, 0x88,
+	0x50, 0x22, 0xE2, 0x48, 0x20, 0x0E, 0xF8, 0x00, 0xE2, 0xC0, 0x48, 0x2C, 0x22, 0x88, 0x10, 0x22,
+	0x08, 0x08, 0x02, 0x00, 0x44, 0x04, 0x09, 0x49, 0x51, 0xFD, 0x15, 0x14, 0x25, 0x49, 0x09, 0xD0,
+	0x93, 0x14, 0x14, 0xC5, 0x5F, 0x41, 0x51, 0x91, 0x90, 0x44, 0x04, 0x00, 0x00, 0x00, 0xF0, 0x0F,
+	0x00, 0x01, 0x20, 0xF0, 0xFF, 0x03, 0x00, 0x20, 0x20, 0x04, 0xF4, 0xBE, 0x20, 0x10, 0x08, 0x0B,
+	0x3E, 0x84, 0x00, 0x02, 0x00, 0x00, 0x08, 0x06, 0x61, 0x21, 0x42, 0x84, 0xD0, 0x20, 0xEE, 0x74,
+	0x49, 0x41, 0x22, 0x90, 0x14, 0xA4, 0x24, 0x19, 0x52, 0x80, 0x10, 0x20, 0x00, 0x00, 0x10, 0xF1,
+	0x27, 0x56, 0x45, 0xD5, 0x48, 0x15, 0xF2, 0xFF, 0x00, 0x00, 0x12, 0x80, 0x18, 0x22, 0x80, 0xFF,
+	0x3F, 0x02, 0x80, 0x00, 0x00, 0x00, 0x40, 0x30, 0xD2, 0x83, 0x04, 0xFD, 0x7F, 0x48, 0x22, 0x92,
+	0x28, 0x02, 0x7A, 0xBE, 0x82, 0xA8, 0x28, 0x2A, 0x8A, 0x7A, 0xBE, 0x00, 0x20, 0x00, 0xC0, 0xFF,
+	0x10, 0x11, 0x44, 0x04, 0xFF, 0x03, 0x00, 0x20, 0x00, 0x48, 0x00, 0x62, 0x80, 0x00, 0x22, 0x80,
+	0xFF, 0x3F, 0x02, 0x80, 0x00, 0x00, 0x00, 0x20, 0xA0, 0x30, 0x28, 0x30, 0x0A, 0x80, 0xFE, 0xBF,
+	0x00, 0x28, 0x00, 0x0A, 0x80, 0xFE, 0xBF, 0x00, 0x28, 0x20, 0x0A, 0x86, 0x60, 0x20, 0x00, 0x00,
+	0x02, 0x90, 0x00, 0xA4, 0x3F, 0x2B, 0x49, 0x4B, 0x96, 0x92, 0xA6, 0x24, 0x29, 0x49, 0x4B, 0xB2,
+	0x92, 0xA4, 0x3F, 0x09, 0x00, 0x02, 0x00, 0x00, 0x04, 0x04, 0x01, 0xC1, 0x3F, 0x10, 0x08, 0x04,
+	0x22, 0x00, 0x84, 0xC0, 0xFC, 0x0F, 0x08, 0x00, 0x02, 0x88, 0x00, 0xE2, 0x7F, 0x00, 0x00, 0x00,
+	0x00, 0x01, 0x48, 0x00, 0xD2, 0xBF, 0x52, 0xF1, 0x55, 0x00, 0x15, 0x40, 0x05, 0x50, 0xF1, 0x54,
+	0x52, 0x95, 0xD2, 0xBF, 0x04, 0x80, 0x01, 0x00, 0x00, 0x20, 0x80, 0x08, 0x48, 0x02, 0xA1, 0x30,
+	0xE0, 0x03, 0x08, 0xF0, 0x03, 0x80, 0x00, 0xE0, 0x1F, 0x0A, 0x48, 0x02, 0x8A, 0x80, 0x20, 0x38,
+	0x00, 0x00, 0x02, 0x82, 0x88, 0x3E, 0x21, 0x28, 0x04, 0x02, 0x81, 0x40, 0xBF, 0x0F, 0x09, 0x42,
+	0x42, 0x90, 0x08, 0x24, 0x01, 0x09, 0x00, 0x02, 0x00, 0x00, 0x40, 0xA0, 0x10, 0xC4, 0xFC, 0x00,
+	0x40, 0x88, 0x20, 0x22, 0xFA, 0x7F, 0x22, 0x82, 0x88, 0x20, 0x22, 0xF8, 0xFF, 0x22, 0x82, 0x88,
+	0x20, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x20, 0x00, 0x08, 0x00, 0x02, 0x80, 0xFF, 0x3F, 0x08,
+	0x08, 0x02, 0x82, 0x80, 0x20, 0x20, 0x08, 0x08, 0x00, 0x02, 0x00, 0x02, 0x80, 0x00, 0x20, 0x00,
+	0x08, 0x00, 0x02, 0x80, 0xFF, 0x2F, 0x00, 0x08, 0x00, 0x22, 0x80, 0x10, 0x20, 0x18, 0x08, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x84, 0x10, 0x11, 0x54, 0x62, 0x55, 0x68, 0x2D, 0xD2, 0x89, 0x5C, 0x22,
+	0x95, 0x6F, 0x25, 0x56, 0x89, 0x54, 0x22, 0x11, 0x08, 0x04, 0x02, 0x00, 0x00, 0x20, 0x00, 0xE6,
+	0x7F, 0x48, 0x20, 0x92, 0x8A, 0xA4, 0x22, 0xA9, 0x48, 0x7F, 0x52, 0xA5, 0x54, 0x29, 0x55, 0x7A,
+	0x90, 0x00, 0x38, 0x00, 0x80, 0x10, 0x20, 0x03, 0xFF, 0x3F, 0x12, 0x00, 0x48, 0xD2, 0x97, 0x5F,
+	0x15, 0x55, 0x43, 0x75, 0x50, 0x35, 0x5F, 0x15, 0x7D, 0x49, 0x40, 0x02, 0x00, 0x20, 0x00, 0x04,
+	0xC0, 0xFF, 0x0F, 0x00, 0x04, 0x00, 0xD5, 0x4F, 0x15, 0x55, 0x45, 0x56, 0x11, 0x55, 0x44, 0x15,
+	0x51, 0xFD, 0x04, 0x00, 0x00, 0x00, 0x04, 0x0A, 0x41, 0xCC, 0x0F, 0x00, 0x84, 0x00, 0xA6, 0xBF,
+	0xBA, 0x2A, 0xAA, 0x8A, 0xAA, 0xA2, 0xAA, 0xAA, 0x6A, 0xFA, 0x8B, 0x00, 0x02, 0x00, 0x40, 0x00,
+	0x08, 0x80, 0xFF, 0x1F, 0x00, 0x80, 0x90, 0x27, 0x22, 0x69, 0x48, 0x06, 0xF2, 0xBF, 0x64, 0x20,
+	0x69, 0x78, 0x22, 0x80, 0x10, 0x00, 0x40, 0x10, 0x10, 0x02, 0x44, 0x00, 0xFD, 0xCF, 0x00, 0x1C,
+	0x08, 0x24, 0x02, 0x89, 0x48, 0x22, 0x92, 0xFE, 0x64, 0x02, 0x89, 0x40, 0x20, 0x00, 0x00, 0x00,
+	0x20, 0x10, 0xE4, 0xFF, 0x08, 0x41, 0xFE, 0x1F, 0x10, 0xE8, 0xFF, 0x09, 0x81, 0xFE, 0x3F, 0x10,
+	0x80, 0x3F, 0x02, 0x80, 0xFF, 0x3F, 0x00, 0xE0, 0xFF, 0x0B, 0x10, 0x32, 0x84, 0xF3, 0x00, 0x02,
+	0x41, 0x34, 0x28, 0x21, 0x49, 0x38, 0xFE, 0x93, 0x04, 0x28, 0x01, 0x44, 0x01, 0x82, 0x01, 0x00,
+	0x00, 0x02, 0x84, 0x00, 0x11, 0x20, 0xFC, 0x94, 0xD1, 0x69, 0x44, 0x14, 0x11, 0x45, 0x24, 0x11,
+	0x45, 0xC4, 0x10, 0x11, 0xFC, 0x00, 0x00, 0x00, 0xC0, 0x21, 0x10, 0x08, 0x24, 0x02, 0x89, 0x40,
+	0x22, 0x96, 0x88, 0x26, 0x3F, 0xA9, 0x40, 0x26, 0x90, 0x08, 0x04, 0x02, 0x81, 0xC0, 0x21, 0x00,
+	0x00, 0x24, 0x04, 0xC9, 0xC0, 0xFF, 0x8B, 0x02, 0x22, 0x01, 0x08, 0x01, 0x31, 0x3C, 0x80, 0x08,
+	0x20, 0xF2, 0x8F, 0x00, 0xA0, 0x04, 0x18, 0x06, 0x00, 0x00, 0x00, 0x02, 0x84, 0x7F, 0x66, 0x12,
+	0x98, 0xFC, 0x27, 0x81, 0x49, 0x60, 0x12, 0x98, 0xFC, 0x27, 0x81, 0x7F, 0x24, 0xC0, 0x08, 0x00,
+	0x02, 0x00, 0x20, 0x08, 0x08, 0x21, 0x22, 0x88, 0x06, 0x22, 0xA0, 0x08, 0x28, 0xFE, 0x8B, 0x00,
+	0x22, 0x80, 0x28, 0x20, 0x12, 0x80, 0x08, 0x20, 0x0C, 0x00, 0x00, 0x00, 0x02, 0x60, 0xFE, 0x87,
+	0x00, 0x28, 0x04, 0x0A, 0x81, 0x42, 0xA0, 0xFE, 0x2F, 0x04, 0x0A, 0x81, 0x42, 0xA2, 0x10, 0x2B,
+	0x00, 0x02, 0x00, 0x02, 0xA0, 0xFA, 0xA7, 0x12, 0xA8, 0x04, 0x2A, 0x81, 0x4A, 0xF0, 0x1E, 0xA8,
+	0x04, 0x2A, 0x81, 0x4A, 0xA0, 0x12, 0xA8, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x04, 0x80, 0x00, 0xF8,
+	0xFF, 0x01, 0x20, 0x02, 0xB0, 0x7F, 0x00, 0x09, 0x24, 0x40, 0xFD, 0xFF, 0x49, 0x54, 0x12, 0xF6,
+	0x6F, 0x01, 0x00, 0x00, 0x64, 0x00, 0x09, 0x40, 0xF2, 0xBD, 0x04, 0x24, 0x01, 0x49, 0xF0, 0xFE,
+	0x93, 0x04, 0x24, 0xD1, 0x4B, 0x44, 0xF2, 0x91, 0x00, 0x64, 0x00, 0x00, 0xC0, 0x01, 0x12, 0x80,
+	0x24, 0x2F, 0x49, 0x44, 0x17, 0x95, 0x24, 0x26, 0x07, 0x49, 0x46, 0x17, 0x92, 0x84, 0x24, 0x2F,
+	0x01, 0xC8, 0x01, 0x03, 0x00, 0x0C, 0x00, 0x41, 0x40, 0x09, 0x30, 0x01, 0xE4, 0x7F, 0x55, 0x61,
+	0x54, 0x10, 0x15, 0x44, 0x05, 0x53, 0x41, 0x55, 0x10, 0x11, 0x0C, 0x00, 0x00, 0x00, 0x04, 0x80,
+	0x00, 0xF8, 0xFF, 0x01, 0x00, 0x00, 0xF0, 0x7F, 0x44, 0x08, 0x11, 0x41, 0x04, 0xF9, 0x8F, 0x42,
+	0x8C, 0x10, 0x04, 0x84, 0x03, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x10, 0x10, 0x04, 0x04, 0x01, 0x41,
+	0xF0, 0xFF, 0x13, 0x04, 0x04, 0x01, 0x41, 0x40, 0x10, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x40, 0x00,
+	0x10, 0xFC, 0x04, 0x01, 0x5D, 0x40, 0xD5, 0x55, 0x55, 0x56, 0x15, 0x55, 0x45, 0xD5, 0xD1, 0x05,
+	0x04, 0x21, 0xC1, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x20, 0x01, 0x48, 0x08, 0x12, 0x82, 0x84, 0x60,
+	0x21, 0xE8, 0xFF, 0x13, 0x82, 0x84, 0x20, 0x21, 0x48, 0x08, 0x12, 0x80, 0x00, 0x20, 0x00, 0x00,
+	0x42, 0x88, 0x1C, 0xE2, 0x84, 0x08, 0x21, 0x52, 0x80, 0xB8, 0x08, 0x10, 0x02, 0xF3, 0x3F, 0x20,
+	0x00, 0x08, 0x20, 0x02, 0x88, 0xFF, 0x01, 0x00, 0x84, 0x20, 0x21, 0x46, 0x04, 0x10, 0x71, 0x24,
+	0x20, 0x15, 0xF8, 0x28, 0x52, 0xB0, 0x24, 0x20, 0x11, 0x4C, 0x04, 0x10, 0x12, 0x84, 0x18, 0x00,
+	0xE0, 0xFB, 0x89, 0x40, 0xE2, 0x8F, 0x4F, 0x02, 0x00, 0x90, 0x02, 0x94, 0x03, 0xAB, 0x70, 0x2A,
+	0x90, 0x8A, 0xAC, 0x22, 0xA5, 0x47, 0x0A, 0x00, 0x00, 0x00, 0x88, 0xFF, 0x2F, 0x89, 0x48, 0x12,
+	0x92, 0x44, 0x00, 0x01, 0x0A, 0x7A, 0x8E, 0x82, 0x94, 0x20, 0xE2, 0x49, 0x81, 0x8E, 0x20, 0x20,
+	0x00, 0x20, 0x00, 0x4A, 0x60, 0x62, 0x86, 0x60, 0x20, 0xE6, 0x78, 0x80, 0x00, 0x90, 0x0F, 0x22,
+	0x4C, 0x08, 0x0C, 0xC2, 0x8C, 0x0F, 0x04, 0x00, 0x02, 0x00, 0x5C, 0x00, 0x11, 0x40, 0x14, 0x10,
+	0x09, 0x44, 0x4C, 0x11, 0x60, 0x04, 0x10, 0x81, 0x44, 0x20, 0xFD, 0x4F, 0x04, 0x10, 0x01, 0x5C,
+	0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xA4, 0x3F, 0x29, 0x49, 0x4D, 0xD2, 0x92, 0x80, 0xE4, 0x27,
+	0x89, 0x4A, 0xA2, 0x92, 0xA4, 0xBF, 0x08, 0x80, 0x03, 0x00, 0x00, 0xFC, 0x07, 0x81, 0x40, 0x20,
+	0xF0, 0x1F, 0x00, 0x00, 0xFE, 0x8F, 0x00, 0x30, 0x1F, 0x4B, 0x04, 0x12, 0x81, 0x7C, 0x22, 0x80,
+	0xF8, 0x3F, 0x00, 0x00, 0x11, 0xA0, 0x04, 0xE7, 0x1F, 0x49, 0x42, 0x52, 0x40, 0x02, 0x88, 0x04,
+	0x25, 0x32, 0x8A, 0x11, 0x92, 0x88, 0x02, 0x64, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x2F,
+	0x00, 0x09, 0x40, 0xF2, 0x93, 0x84, 0x24, 0x21, 0x49, 0x48, 0x12, 0x92, 0xFC, 0x24, 0x00, 0x09,
+	0x40, 0xFE, 0x3F, 0x00, 0x80, 0x08, 0x10, 0x02, 0x43, 0xBE, 0x91, 0xA4, 0x2A, 0x49, 0x4A, 0x88,
+	0x12, 0xA5, 0x34, 0x2A, 0x09, 0x49, 0x46, 0xBE, 0x22, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0xFE,
+	0x81, 0x24, 0x20, 0x09, 0x48, 0x02, 0x92, 0xF0, 0xFF, 0x21, 0x89, 0x48, 0x22, 0x92, 0x88, 0x24,
+	0xE2, 0x8F, 0x00, 0x38, 0x00, 0x00, 0x02, 0x82, 0xA0, 0xEF, 0x6B, 0xAA, 0x9A, 0xAA, 0xAE, 0xAA,
+	0xED, 0x7F, 0xAA, 0x9A, 0xAA, 0xA6, 0xAA, 0xEF, 0x2B, 0x08, 0x0A, 0x02, 0x02, 0x00, 0x40, 0x20,
+	0x08, 0x04, 0x85, 0x30, 0x11, 0xC3, 0x03, 0x10, 0x00, 0x04, 0x00, 0x81, 0x43, 0x20, 0xF3, 0x07,
+	0x01, 0x80, 0x00, 0x40, 0x00, 0x00, 0x00, 0x11, 0xA0, 0x04, 0xE7, 0x3F, 0x49, 0x44, 0x92, 0x00,
+	0x00, 0xF8, 0x03, 0x42, 0x80, 0x10, 0xFC, 0xFF, 0x08, 0x01, 0x42, 0x80, 0x3F, 0x00, 0x00, 0x10,
+	0x84, 0xC4, 0x20, 0x0D, 0xF8, 0xFF, 0x91, 0x40, 0x44, 0x00, 0x04, 0xE0, 0x80, 0x00, 0xD0, 0x7F,
+	0x02, 0x60, 0x20, 0x06, 0x30, 0x00, 0x00, 0x80, 0x00, 0x22, 0x80, 0x08, 0x10, 0x0E, 0x84, 0x8C,
+	0x24, 0x14, 0x0E, 0x02, 0x42, 0x81, 0x8C, 0xE0, 0x40, 0x08, 0x10, 0x02, 0x88, 0x00, 0x02, 0x00,
+	0x40, 0xA0, 0x10, 0x24, 0x84, 0x08, 0x11, 0x42, 0x82, 0x70, 0xE0, 0x07, 0x08, 0x7F, 0x42, 0xA0,
+	0x10, 0x28, 0x04, 0x0A, 0x81, 0x40, 0x38, 0x00, 0x40, 0x00, 0x12, 0x40, 0x04, 0x08, 0x81, 0xC1,
+	0x1F, 0x14, 0x01, 0x46, 0x00, 0x11, 0x40, 0x04, 0x12, 0x81, 0xC4, 0x1F, 0x01, 0x40, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xFF, 0x4F, 0x00, 0x10, 0x00, 0xE6, 0x43, 0x89, 0x40, 0x22, 0x90, 0x08, 0x24,
+	0x02, 0xF9, 0x40, 0x00, 0x12, 0x80, 0xFC, 0x3F, 0x00, 0x00, 0x02, 0x84, 0x00, 0xE6, 0x1F, 0x00,
+	0x02, 0x42, 0x90, 0xFC, 0x24, 0x11, 0x49, 0xC4, 0x1F, 0x89, 0x44, 0x22, 0x91, 0xC8, 0x0F, 0x02,
+	0x00, 0x00, 0x08, 0x00, 0xF9, 0x3F, 0x02, 0x98, 0x02, 0xAA, 0x8E, 0xA8, 0x82, 0xAA, 0x90, 0x2A,
+	0xA3, 0x8E, 0x28, 0x68, 0x02, 0xAA, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0xFE, 0x87,
+	0x82, 0xA0, 0x24, 0x6A, 0x69, 0xEA, 0x87, 0x92, 0xA0, 0x24, 0xA8, 0xFF, 0x5A, 0x82, 0x93, 0x00,
+	0x20, 0x00, 0x00, 0x20, 0x40, 0x08, 0x60, 0xFE, 0x01, 0x20, 0x41, 0x44, 0x92, 0x9F, 0x27, 0x3D,
+	0x49, 0x49, 0x52, 0x92, 0x94, 0x24, 0xE5, 0xF9, 0x41, 0x00, 0x00, 0x80, 0x00, 0x2A, 0xA0, 0xEA,
+	0xAB, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xFE, 0x7F, 0xAA, 0x9A, 0xAA, 0xA6, 0xAA, 0xE9, 0x6B, 0x02,
+	0x8A, 0x00, 0x02, 0x00, 0x00, 0xE0, 0x0B, 0x98, 0xFA, 0xA7, 0x82, 0xAF, 0x60, 0x2A, 0x98, 0xCF,
+	0xA7, 0x82, 0xAF, 0x60, 0x2A, 0x98, 0xFA, 0xBF, 0x80, 0x00, 0x20, 0x00, 0x00, 0x00, 0xF8, 0xFF,
+	0x02, 0x84, 0x0C, 0xE1, 0x3C, 0x00, 0x00, 0xF2, 0x87, 0x84, 0x20, 0x21, 0xC8, 0x8F, 0x02, 0xA0,
+	0xFF, 0x2F, 0x00, 0x00, 0x00, 0x20, 0x80, 0x10, 0x46, 0x60, 0x20, 0x86, 0x00, 0x18, 0xFF, 0x49,
+	0x04, 0x12, 0x47, 0x44, 0xD6, 0x1F, 0x42, 0x44, 0x11, 0x8F, 0x1C, 0x20, 0x00, 0x00, 0x00, 0x7E,
+	0x84, 0x11, 0x61, 0x24, 0x18, 0x1D, 0xFD, 0x4A, 0x91, 0x54, 0x24, 0xF2, 0x89, 0x44, 0x12, 0x91,
+	0x42, 0x64, 0xF0, 0x01, 0x00, 0x00, 0x40, 0x20, 0x10, 0x08, 0x02, 0x42, 0x89, 0x48, 0x22, 0x91,
+	0x38, 0xFC, 0x13, 0x89, 0x48, 0x22, 0x94, 0x08, 0x02, 0x02, 0x81, 0x40, 0x20, 0x00, 0x00, 0x00,
+	0x00, 0xFC, 0x7F, 0x52, 0x92, 0x94, 0xA4, 0x24, 0x21, 0x49, 0x40, 0xD2, 0x97, 0x44, 0x26, 0x89,
+	0x7F, 0x22, 0x40, 0x08, 0x80, 0x03, 0x00, 0x40, 0xA0, 0x10, 0xC4, 0xFC, 0x00, 0x40, 0x08, 0x24,
+	0x82, 0x88, 0x10, 0x22, 0x83, 0x3F, 0x20, 0x12, 0x88, 0x08, 0x22, 0x84, 0x08, 0x26, 0x00, 0x00,
+	0x02, 0x80, 0x00, 0x90, 0x00, 0x22, 0x42, 0x88, 0x48, 0x22, 0xE1, 0x90, 0x20, 0x46, 0x48, 0x22,
+	0x8A, 0x90, 0x01, 0x08, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0xC6, 0x1F, 0x50, 0x75, 0x56,
+	0x61, 0x55, 0x48, 0x35, 0x52, 0xB5, 0x54, 0x21, 0x55, 0xCC, 0x1F, 0x00, 0x10, 0x00, 0x18, 0x00,
+	0x00, 0x10, 0x48, 0x04, 0x12, 0x81, 0x44, 0x20, 0x11, 0x4A, 0x84, 0xFE, 0xBF, 0x44, 0x10, 0x11,
+	0x44, 0x04, 0x11, 0x41, 0x44, 0x00, 0x10, 0x00, 0x00, 0x40, 0x20, 0x0E, 0x04, 0xC0, 0xFC, 0x0F,
+	0x20, 0x04, 0x06, 0x26, 0x00, 0x08, 0x00, 0x02, 0xA0, 0x00, 0xE8, 0xFF, 0x0B, 0x00, 0x02, 0x00,
+	0x00, 0x00, 0x00, 0xFA, 0x80, 0x00, 0x3F, 0x40, 0xF8, 0x17, 0x02, 0xFC, 0x10, 0x21, 0xC2, 0x7F,
+	0x10, 0x52, 0x84, 0x64, 0x3F, 0x01, 0x48, 0x00, 0x02, 0x00, 0xFC, 0x07, 0x81, 0x40, 0x20, 0xF0,
+	0x1F, 0x00, 0x20, 0x00, 0xE6, 0x7F, 0x88, 0x00, 0x22, 0x80, 0x08, 0x10, 0xFE, 0x87, 0x00, 0x20,
+	0x00, 0x00, 0x80, 0x10, 0x22, 0x84, 0xFF, 0x3F, 0x22, 0x80, 0x04, 0x00, 0x40, 0x84, 0x10, 0x21,
+	0x44, 0x08, 0x11, 0x42, 0x84, 0x10, 0x21, 0xC4, 0xFF, 0x03, 0x00, 0x08, 0x21, 0x42, 0xF8, 0xFF,
+	0x23, 0x02, 0x08, 0x00, 0xF9, 0xFF, 0x12, 0x91, 0x44, 0xE4, 0x1F, 0x49, 0xF4, 0x12, 0x91, 0xFF,
+	0x04, 0x00, 0x00, 0x00, 0x09, 0x28, 0x02, 0xBF, 0xBA, 0xAA, 0xAA, 0xAB, 0x3E, 0xAB, 0xFA, 0x2A,
+	0xA1, 0xAA, 0xAA, 0x4E, 0xAA, 0x92, 0xBA, 0x2B, 0x20, 0x0A, 0x00, 0x00, 0x20, 0x00, 0x0A, 0x60,
+	0xF2, 0x93, 0x44, 0x24, 0x11, 0x49, 0xF4, 0x13, 0x91, 0x44, 0x24, 0x11, 0x49, 0x44, 0xF2, 0x83,
+	0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x42, 0x84, 0x90, 0xBE, 0x9F, 0x28, 0x21, 0x4E, 0xF8, 0x36,
+	0xA2, 0x96, 0x2F, 0x21, 0x4A, 0x8A, 0xFE, 0x3E, 0x04, 0x08, 0x01, 0x02, 0x00, 0x0C, 0x20, 0x01,
+	0x44, 0xF2, 0x90, 0x40, 0x24, 0x60, 0x09, 0x68, 0xFE, 0x93, 0x88, 0x24, 0x22, 0x89, 0x48, 0x22,
+	0x12, 0x80, 0x0C, 0x20, 0x00, 0x00, 0x02, 0x80, 0x00, 0xFF, 0x0F, 0x04, 0x01, 0x21, 0x42, 0x44,
+	0x02, 0x88, 0x80, 0xE1, 0x1F, 0x08, 0x00, 0x02, 0xA0, 0x00, 0xE8, 0xFF, 0x01, 0x00, 0x08, 0x21,
+	0x42, 0xF8, 0xFF, 0x23, 0x02, 0x10, 0x22, 0xFA, 0x74, 0xA2, 0x90, 0x18, 0xE4, 0x03, 0x8D, 0xC1,
+	0xA2, 0x80, 0x4F, 0x00, 0x22, 0x00, 0x80, 0x10, 0x22, 0x84, 0xFF, 0x3F, 0x22, 0x00, 0x00, 0x30,
+	0x81, 0x24, 0x61, 0x45, 0x68, 0xF0, 0x13, 0x84, 0x14, 0x21, 0x49, 0xC8, 0x04, 0x02, 0x00, 0xFE,
+	0xA3, 0x00, 0xA6, 0x7F, 0x08, 0x20, 0xFE, 0x13, 0x08, 0x08, 0x01, 0xBE, 0x43, 0x08, 0x0B, 0x02,
+	0x81, 0xB0, 0xE0, 0x43, 0x08, 0x20, 0x00, 0xC0, 0x7F, 0x10, 0x08, 0x04, 0x02, 0xFF, 0x01, 0x08,
+	0x28, 0x02, 0xB2, 0xA0, 0x20, 0xE8, 0xFF, 0x07, 0x02, 0xA1, 0x40, 0x26, 0x00, 0x08, 0x00, 0x00,
+	0xFC, 0x07, 0x81, 0x40, 0x20, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0x04, 0x80, 0x00,
+	0x20, 0x00, 0x04, 0xFC, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x08, 0x11, 0x42, 0x94, 0x08, 0x29, 0x41,
+	0x28, 0x10, 0x06, 0xFF, 0x3F, 0x61, 0x40, 0x28, 0x90, 0x12, 0x94, 0x08, 0x21, 0x04, 0x08, 0x01,
+	0x00, 0x00, 0x00, 0xFF, 0x4F, 0x12, 0x91, 0x44, 0x26, 0x51, 0x49, 0x44, 0x12, 0x91, 0x44, 0x24,
+	0x11, 0x49, 0x44, 0x12, 0xF1, 0xFF, 0x00, 0x00, 0x00, 0x80, 0x10, 0x22, 0x84, 0xFF, 0x3F, 0x22,
+	0x00, 0x00, 0x79, 0x20, 0x10, 0x06, 0x74, 0xF8, 0x6B, 0x41, 0x22, 0x92, 0x14, 0xE5, 0x08, 0x01,
+	0x02, 0x00, 0x40, 0x00, 0x10, 0xF0, 0x24, 0x24, 0x0D, 0xC9, 0x42, 0x92, 0x90, 0x24, 0x24, 0x09,
+	0x49, 0x62, 0x92, 0xF8, 0xE4, 0x01, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0xE2, 0x7F, 0x48, 0x00,
+	0x12, 0x82, 0x84, 0x20, 0x1F, 0x08, 0x20, 0x02, 0xF4, 0xBF, 0x20, 0x10, 0x09, 0x8B, 0x3A, 0x84,
+	0xC0, 0x03, 0x00, 0x10, 0x11, 0x67, 0x34, 0x15, 0xC1, 0x24, 0x0C, 0x09, 0x00, 0x00, 0x09, 0x41,
+	0x42, 0xFF, 0x0B, 0x22, 0x91, 0xA4, 0x28, 0x45, 0x40, 0x3C, 0x00, 0x80, 0x02, 0x98, 0x7C, 0x24,
+	0x01, 0x49, 0xF0, 0xFF, 0x93, 0x04, 0x24, 0x11, 0xC9, 0x07, 0x00, 0xF0, 0x8F, 0x00, 0xE0, 0xFF,
+	0x0F, 0x00, 0x00, 0x00, 0x08, 0x21, 0x42, 0xF8, 0xFF, 0x23, 0x02, 0x48, 0x00, 0x00, 0xE0, 0xFF,
+	0x0B, 0x41, 0xC2, 0x8B, 0x14, 0x21, 0xA5, 0x78, 0x47, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0xFE,
+	0x80, 0x10, 0x20, 0x04, 0x08, 0xFD, 0x43, 0x88, 0x10, 0x22, 0x84, 0x08, 0x21, 0x42, 0x88, 0x3F,
+	0x02, 0x80, 0x00, 0x00, 0x00, 0x04, 0x08, 0xBD, 0x59, 0x09, 0x5A, 0xFE, 0x94, 0x02, 0x3D, 0x43,
+	0x00, 0x42, 0x40, 0xFF, 0x0F, 0x04, 0x20, 0xFF, 0x51, 0x80, 0x10, 0x38, 0x00, 0x00, 0x11, 0x71,
+	0x46, 0x53, 0x11, 0x4C, 0xC2, 0x90, 0x00, 0x08, 0x24, 0x3F, 0x69, 0xF5, 0x57, 0x91, 0x54, 0x3C,
+	0x95, 0xC9, 0x0F, 0x02, 0x00, 0x00, 0x0C, 0x21, 0x41, 0x48, 0x12, 0x91, 0x24, 0x24, 0x47, 0x49,
+	0x60, 0x12, 0x90, 0x04, 0x24, 0x1F, 0x49, 0x48, 0x12, 0x12, 0x84, 0x0C, 0x39, 0x00, 0x80, 0x10,
+	0x22, 0x84, 0xFF, 0x3F, 0x22, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0xA4, 0x80, 0xC4, 0x81, 0x00, 0x18,
+	0xFF, 0x01, 0x80, 0x01, 0x80, 0x03, 0x00, 0x4A, 0x21, 0x4B, 0x89, 0x79, 0xFD, 0x65, 0x18, 0x09,
+	0xCB, 0xA5, 0x04, 0x02, 0x01, 0x30, 0xE0, 0xF3, 0x84, 0xC0, 0xE0, 0x4F, 0x08, 0x20, 0x00, 0x00,
+};
+
+// 143 glyphs, 6 x 6 pixels, 644 bytes (858 unpacked) - generated by utils/main.cpp from CNFont6[]
+const uint8_t CNFont6Packed[] =
+{
+	0xC4, 0xC6, 0x8D, 0xA2, 0x00, 0x34, 0xDE, 0xC7, 0x41, 0xD0, 0xAF, 0x19, 0x1F, 0x04, 0x08, 0x9F,
+	0xE4, 0x01, 0xDE, 0xE3, 0x5B, 0x9D, 0xC0, 0x38, 0x89, 0xE3, 0x60, 0x80, 0xE3, 0x39, 0x1E, 0x40,
+	0x5A, 0x9E, 0x62, 0x11, 0x46, 0x66, 0x7E, 0x1A, 0x00, 0x5A, 0x9A, 0xE6, 0x02, 0x80, 0x94, 0x69,
+	0x14, 0x00, 0x38, 0xCF, 0xEF, 0x00, 0xC0, 0xD7, 0xDC, 0x0E, 0x00, 0x70, 0xD0, 0x07, 0x01, 0xC4,
+	0x5E, 0x79, 0xD2, 0x87, 0x74, 0x4B, 0xE7, 0x21, 0x80, 0xE3, 0x29, 0x0E, 0x20, 0x7C, 0x8A, 0xF7,
+	0x20, 0x80, 0x66, 0x3D, 0x93, 0xAC, 0x7C, 0xD2, 0x23, 0x01, 0x90, 0x6F, 0x79, 0x15, 0x21, 0x7D,
+	0x9E, 0xE5, 0x09, 0x90, 0xD3, 0x19, 0x7D, 0x80, 0x78, 0x8A, 0xE2, 0x01, 0xC2, 0xA7, 0x56, 0x9A,
+	0x61, 0x74, 0x5E, 0xBB, 0x19, 0xD0, 0x6A, 0x75, 0x0E, 0x03, 0x38, 0x56, 0x7B, 0x31, 0x42, 0xA1,
+	0xB9, 0x1A, 0x40, 0x7C, 0x52, 0xA7, 0x11, 0x80, 0x47, 0x69, 0x14, 0x00, 0x7E, 0x5A, 0xE5, 0x01,
+	0x80, 0xA7, 0x42, 0x0F, 0x60, 0x74, 0xAE, 0xE7, 0x01, 0x90, 0x23, 0x08, 0x02, 0xA0, 0x7C, 0x9B,
+	0xF7, 0x01, 0xA0, 0xA5, 0x7E, 0xD3, 0xA3, 0x5C, 0x9E, 0x62, 0x21, 0x20, 0xE5, 0x78, 0x05, 0x01,
+	0x62, 0x96, 0xA2, 0x01, 0x84, 0xD5, 0x6A, 0x16, 0x42, 0x68, 0xE4, 0x66, 0x09, 0xC2, 0xFE, 0x5A,
+	0x9D, 0x80, 0x78, 0x9E, 0xFA, 0x01, 0xEC, 0xA5, 0x7A, 0x95, 0x06, 0x38, 0x84, 0xF2, 0x01, 0x00,
+	0xE7, 0x79, 0x15, 0x40, 0x70, 0x96, 0xC5, 0x11, 0x80, 0x83, 0x7A, 0x02, 0x07, 0xF4, 0xCB, 0xD2,
+	0x09, 0xA4, 0xC5, 0x78, 0x24, 0x01, 0xAB, 0xA4, 0xC7, 0x00, 0x80, 0xA7, 0x59, 0x1B, 0x00, 0x40,
+	0x1E, 0x05, 0x01, 0x40, 0xE0, 0x15, 0x05, 0x00, 0x54, 0x9E, 0x55, 0x11, 0xD0, 0xB3, 0x7C, 0x2F,
+	0x26, 0x7C, 0xE9, 0xD7, 0x01, 0x80, 0xA7, 0x75, 0x1A, 0x00, 0x75, 0x96, 0xD6, 0x01, 0x80, 0x77,
+	0x75, 0x1A, 0x80, 0xD4, 0x4A, 0x9F, 0x20, 0x98, 0xE9, 0x15, 0x4E, 0x04, 0x78, 0x5A, 0xAF, 0x00,
+	0x80, 0xD2, 0x79, 0x1A, 0xA0, 0x28, 0x4A, 0xA7, 0x00, 0x80, 0x57, 0xAD, 0x9A, 0x04, 0x7C, 0xDB,
+	0xF6, 0x01, 0x10, 0x53, 0x74, 0x0D, 0x00, 0x79, 0x91, 0x57, 0x01, 0xA0, 0xE7, 0x38, 0x0E, 0x40,
+	0x6C, 0x96, 0x66, 0x61, 0x84, 0xA6, 0x78, 0x1D, 0x01, 0x68, 0xDE, 0xAB, 0x02, 0x80, 0x61, 0x39,
+	0x0E, 0x40, 0x6C, 0x9E, 0x95, 0x41, 0x80, 0xE1, 0x29, 0x06, 0x80, 0x15, 0x9B, 0x56, 0x62, 0x00,
+	0xD4, 0x69, 0x12, 0x00, 0x39, 0xAC, 0x27, 0x70, 0x88, 0xE6, 0x59, 0x16, 0x20, 0x74, 0x96, 0xA2,
+	0x11, 0x90, 0xD3, 0x6A, 0x1F, 0x00, 0x39, 0x8A, 0xE5, 0x01, 0x80, 0x62, 0x78, 0x06, 0x01, 0x78,
+	0xEA, 0xD5, 0x09, 0x80, 0xE3, 0x35, 0x8E, 0x44, 0x7C, 0x96, 0xE6, 0x02, 0x80, 0xB7, 0x55, 0x1E,
+	0xA0, 0xD4, 0x6E, 0x6B, 0x01, 0x80, 0xE3, 0x79, 0x1E, 0x04, 0x7C, 0xDB, 0xF5, 0x01, 0x80, 0x95,
+	0x9C, 0x1C, 0x61, 0x74, 0x8E, 0xE2, 0x01, 0x80, 0xDF, 0x4A, 0x0C, 0x01, 0x8A, 0x9E, 0x27, 0x0A,
+	0x20, 0xA5, 0x74, 0x25, 0x20, 0x4A, 0x8F, 0xE9, 0x01, 0x80, 0xD7, 0x38, 0x1E, 0x00, 0x70, 0x9C,
+	0xD5, 0x01, 0x42, 0xA7, 0x69, 0x1E, 0x00, 0xBD, 0x59, 0xF3, 0x01, 0x00, 0x27, 0x79, 0x1E, 0x20,
+	0x74, 0x5E, 0xD7, 0x01, 0xC0, 0x77, 0x55, 0x1F, 0x90, 0x3B, 0x45, 0xE3, 0x01, 0x54, 0xEA, 0x79,
+	0x9E, 0x00, 0x6C, 0xDF, 0xF5, 0x00, 0x00, 0xE5, 0x79, 0x1C, 0x00, 0x7C, 0x9E, 0xF7, 0x42, 0x10,
+	0x27, 0x7D, 0x1A, 0x00, 0x10, 0x9A, 0xC5, 0x00, 0x80, 0xA7, 0x69, 0x16, 0x04, 0x20, 0xDE, 0x92,
+	0x00, 0xC4, 0x27, 0x04, 0x1E, 0x00, 0x78, 0xDD, 0xC6, 0x01, 0x80, 0xE3, 0x15, 0x1D, 0x20, 0x7C,
+	0x96, 0x65, 0x79, 0xC8, 0xE7, 0x6D, 0x1F, 0x27, 0xD4, 0x97, 0xA5, 0x11, 0x84, 0x6F, 0x59, 0x1C,
+	0x80, 0x58, 0x93, 0xE4, 0x01, 0xA0, 0x26, 0x79, 0x2A, 0x00, 0x7C, 0x92, 0x13, 0x7A, 0xC2, 0xE7,
+	0x7E, 0x1C, 0xA2, 0x7C, 0xE6, 0xA6, 0x1A, 0x80, 0x77, 0x5D, 0x9E, 0x00, 0x38, 0x86, 0x57, 0x08,
+	0x80, 0x23, 0x38, 0x1E, 0x00, 0x58, 0x9E, 0x63, 0x11, 0x80, 0xE7, 0xBA, 0x3E, 0xA0, 0x7C, 0xB2,
+	0xB7, 0x09, 0xC4, 0xD1, 0xB4, 0x1F, 0x01, 0x39, 0xDA, 0xE5, 0x49, 0xC8, 0x67, 0x7D, 0x1A, 0xAD,
+	0x38, 0x14, 0xE3, 0x01, 0xCA, 0xE7, 0x55, 0x1F, 0x00, 0x60, 0x94, 0xA6, 0x01, 0x50, 0xC7, 0x4A,
+	0x1C, 0x20, 0x74, 0xCA, 0xA5, 0x01, 0xA2, 0xA4, 0x68, 0xA2, 0xA0, 0x7C, 0x7E, 0xEA, 0x01, 0x88,
+	0xE7, 0x5B, 0x9C, 0x00,
+};
+
+#else
+
+// source bitmaps for the packed tables above, see create_packed_cn_fonts() in utils/main.cpp
+
 const uint8_t CNFont14[][28] =
 {
 	{0xF0,0x00,0xFF,0x10,0x20,0x10,0xF0,0x10,0x11,0x16,0x10,0x10,0x10,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x3F,0x20,0x20,0x20,0x20,0x20,0x20,0x00},/*"忙",0*/
@@ -457,6 +883,8 @@ const uint8_t CNFont14[][28] =
 
 };
 
+#endif
+
 const uint8_t gFontBig[95 - 1][16 - 2] =
 {
 #if 0
@@ -723,6 +1151,8 @@ const uint8_t gFontSmallDigits[11][7] =
 };
 */
 
+#ifndef ENABLE_PACKED_CN_FONT
+
 const uint8_t CNFont6[][6] = 
 {
 	{0x04,0x1B,0x1C,0x23,0x22,0x02},/*"忙",0*/
@@ -1157,6 +1587,8 @@ const uint8_t CNFont6[][6] =
 
 };
 
+#endif
+
 const uint8_t gFontSmall[95-1][6] =
 {
 //  {0x00, 0x00, 0x00, 0x00, 0x00, 0x00},    // ' '
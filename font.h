@@ -26,8 +26,16 @@ extern const uint8_t gFont3x5[96][3];
 extern const uint8_t gFontSmall[95 - 1][6];
 
 extern const char *CNList;
-extern const uint8_t CNFont14[][28];
-extern const uint8_t CNFont6[][6];
+extern const uint32_t CNIndex[];
+extern const unsigned int CNIndexCount;
+#ifdef ENABLE_PACKED_CN_FONT
+	// glyph columns stored back to back, only the used rows - see create_packed_cn_fonts() in utils/main.cpp
+	extern const uint8_t CNFont14Packed[];
+	extern const uint8_t CNFont6Packed[];
+#else
+	extern const uint8_t CNFont14[][28];
+	extern const uint8_t CNFont6[][6];
+#endif
 
 #ifdef ENABLE_SMALL_BOLD
 	extern const uint8_t gFontSmallBold[95 - 1][6];
@@ -16,6 +16,12 @@
 
 #include <string.h>
 
+#ifdef ENABLE_TASK_SCHEDULER
+	#include "app/app.h"
+#endif
+#ifdef ENABLE_TICKLESS_IDLE
+	#include "scheduler.h"
+#endif
 #include "app/dtmf.h"
 #if defined(ENABLE_FMRADIO)
 	#include "app/fm.h"
@@ -68,7 +74,11 @@ void FUNCTION_Init(void)
 	g_SquelchLost      = false;
 
 	gFlagTailNoteEliminationComplete   = false;
-	gTailNoteEliminationCountdown_10ms = 0;
+	#ifdef ENABLE_TASK_SCHEDULER
+		SCHEDULER_Stop(&gTailNoteEliminationTask);
+	#else
+		gTailNoteEliminationCountdown_10ms = 0;
+	#endif
 	gFoundCTCSS                        = false;
 	gFoundCDCSS                        = false;
 	gFoundCTCSSCountdown_10ms          = 0;
@@ -94,6 +104,10 @@ void FUNCTION_Select(FUNCTION_Type_t Function)
 		BK4819_Conditional_RX_TurnOn_and_GPIO6_Enable();
 		gRxIdleMode = false;
 		UI_DisplayStatus();
+
+		#ifdef ENABLE_TICKLESS_IDLE
+			SCHEDULER_EndTicklessIdle();
+		#endif
 	}
 
 	switch (Function)
@@ -16,6 +16,7 @@
 
 #include "battery.h"
 #include "driver/backlight.h"
+#include "driver/eeprom.h"
 #include "driver/st7565.h"
 #include "functions.h"
 #include "misc.h"
@@ -204,6 +205,11 @@ void BATTERY_TimeSlice500ms(void)
 
 						gReducedService = true;
 
+						#ifdef ENABLE_EEPROM_WRITE_BEHIND
+							// the radio is shutting down, don't leave settings behind in RAM
+							EEPROM_Flush();
+						#endif
+
 						//if (gCurrentFunction != FUNCTION_POWER_SAVE)
 							FUNCTION_Select(FUNCTION_POWER_SAVE);
 
@@ -0,0 +1,68 @@
+#!/usr/bin/env python3
+
+# Grabs the display contents from a radio built with ENABLE_UART_SCREENSHOT
+# and writes them to a PBM image, so UI changes can be checked on the PC.
+#
+#   lcd-dump.py <serial port> <image.pbm>
+
+import crcmod
+import serial
+import struct
+import sys
+
+from itertools import cycle
+
+OBFUSCATION = [
+        0x16, 0x6C, 0x14, 0xE6, 0x2E, 0x91, 0x0D, 0x40, 0x21, 0x35, 0xD5, 0x40, 0x13, 0x03, 0xE9, 0x80,
+    ]
+
+def obfuscate(data):
+    return bytes([a^b for a, b in zip(data, cycle(OBFUSCATION))])
+
+def send_command(port, cmd_id, payload=b''):
+    body = struct.pack('<HH', cmd_id, len(payload)) + payload
+    crc = crcmod.predefined.Crc('xmodem')
+    crc.update(body)
+    body += struct.pack('<H', crc.crcValue)
+    port.write(struct.pack('<HH', 0xCDAB, len(body) - 2) + obfuscate(body) + struct.pack('<H', 0xBADC))
+
+def read_reply(port):
+    header = port.read(4)
+    if len(header) != 4:
+        raise IOError('timeout waiting for reply')
+    magic, size = struct.unpack('<HH', header)
+    if magic != 0xCDAB:
+        raise IOError('bad reply header %04X' % magic)
+    body = port.read(size + 4)
+    if len(body) != size + 4:
+        raise IOError('short reply')
+    return obfuscate(body[:size])
+
+port = serial.Serial(sys.argv[1], 38400, timeout=1)
+
+send_command(port, 0x0531)
+
+lines = [None] * 8
+blits = 0
+count = 0
+while None in lines:
+    reply = read_reply(port)
+    reply_id, size, line, blits, count = struct.unpack('<HHB3xII', reply[:16])
+    if reply_id != 0x0532 or line >= 8:
+        continue
+    lines[line] = reply[16:16 + 128]
+
+# each byte is a column of 8 pixels, LSB on top
+image = bytearray()
+for y in range(64):
+    page = lines[y // 8]
+    for x in range(0, 128, 8):
+        b = 0
+        for bit in range(8):
+            if page[x + bit] & (1 << (y % 8)):
+                b |= 0x80 >> bit
+        image.append(b)
+
+open(sys.argv[2], 'wb').write(b'P4\n128 64\n' + bytes(image))
+
+print('%u blits, %u bytes sent to the LCD' % (blits, count))
@@ -28,7 +28,11 @@
 #include "board.h"
 #include "driver/backlight.h"
 #include "driver/bk4819.h"
+#include "driver/eeprom.h"
 #include "driver/gpio.h"
+#ifdef ENABLE_LCD_DMA
+	#include "driver/st7565.h"
+#endif
 #include "driver/system.h"
 #include "driver/systick.h"
 #include "driver/uart.h"
@@ -36,6 +40,15 @@
 #include "helper/boot.h"
 #include "misc.h"
 #include "radio.h"
+#ifdef ENABLE_BOOT_TIMING
+	#include "external/printf/printf.h"
+#endif
+#if defined(ENABLE_BOOT_TIMING) || defined(ENABLE_TASK_SCHEDULER)
+	#include "scheduler.h"
+#endif
+#ifdef ENABLE_TASK_SCHEDULER
+	#include "ARMCM0.h"
+#endif
 #include "settings.h"
 #include "ui/lock.h"
 #include "ui/welcome.h"
@@ -47,6 +60,94 @@ void _putchar(char c)
 	UART_Send((uint8_t *)&c, 1);
 }
 
+#ifdef ENABLE_BOOT_TIMING
+	enum BOOT_Phase_t
+	{
+		BOOT_PHASE_BK4819 = 0,
+		BOOT_PHASE_EEPROM,
+		BOOT_PHASE_CALIBRATION,
+		BOOT_PHASE_VFOS,
+		BOOT_PHASE_REGISTERS,
+		BOOT_PHASE_BATTERY,
+		BOOT_PHASE_WELCOME,
+		BOOT_PHASE_MAIN_LOOP,    // from here on the radio receives
+		BOOT_PHASE_BACKGROUND,   // everything that was left for the main loop is loaded
+		BOOT_PHASE_COUNT
+	};
+
+	static const char * const BootPhaseNames[BOOT_PHASE_COUNT] =
+	{
+		"bk4819", "eeprom", "calib", "vfos", "regs", "battery", "welcome", "mainloop", "background"
+	};
+
+	// time since power up at the end of each phase
+	static uint32_t BootPhaseTime_us[BOOT_PHASE_COUNT];
+
+	#define BOOT_STAMP(Phase)   BootPhaseTime_us[Phase] = SCHEDULER_GetUptimeUs()
+
+	static void BootReport(void)
+	{
+		char         String[32];
+		unsigned int i;
+
+		for (i = 0; i < BOOT_PHASE_COUNT; i++)
+		{
+			sprintf(String, "boot %-10s %7luus\r\n", BootPhaseNames[i], (unsigned long)BootPhaseTime_us[i]);
+			UART_Send(String, strlen(String));
+		}
+	}
+#else
+	#define BOOT_STAMP(Phase)
+#endif
+
+#ifdef ENABLE_STAGED_BOOT
+	// memory channel records loaded per main loop pass, 256 bytes is about 6ms of I2C
+	#define BOOT_CHANNELS_PER_PASS   16u
+
+	// the VFO the radio doesn't start receiving on, still to be configured
+	static bool bBootVfoPending;
+
+	static bool BootBackground(void)
+	{	// loads what the radio didn't need to start receiving, a slice at a time so the main loop keeps going,
+		// returns true once it's all in. DTMF contacts aren't loaded at boot, they're looked up when needed
+		if (bBootVfoPending)
+		{	// first pass, before anything in the main loop can look at it
+			RADIO_ConfigureChannel(!gEeprom.TX_VFO, VFO_CONFIGURE_RELOAD);
+			bBootVfoPending = false;
+			gUpdateDisplay  = true;
+
+			#ifdef ENABLE_FMRADIO
+				BOARD_EEPROM_LoadFMChannels();
+			#endif
+
+			return false;
+		}
+
+		#ifdef ENABLE_CHANNEL_TABLE
+			// until then RADIO_ConfigureChannel() reads the channels that aren't in yet from the EEPROM
+			return BOARD_EEPROM_LoadChannelTable(BOOT_CHANNELS_PER_PASS);
+		#else
+			return true;
+		#endif
+	}
+#endif
+
+#ifdef ENABLE_TASK_SCHEDULER
+	static void TimeSlice500ms(void)
+	{	// the 500ms countdowns used to be run by the systick interrupt
+		if (gTxTimerCountdown_500ms > 0)
+			if (--gTxTimerCountdown_500ms == 0)
+				gTxTimeoutReached = true;
+
+		if (gSerialConfigCountDown_500ms > 0)
+			gSerialConfigCountDown_500ms--;
+
+		APP_TimeSlice500ms();
+	}
+
+	static SCHEDULER_Task_t gTimeSlice500msTask = SCHEDULER_TASK(TimeSlice500ms, SCHEDULER_PRIORITY_LOW);
+#endif
+
 void Main(void)
 {
 	unsigned int i;
@@ -80,24 +181,44 @@ void Main(void)
 	gDTMF_String[sizeof(gDTMF_String) - 1] = 0;
 
 	BK4819_Init();
+	BOOT_STAMP(BOOT_PHASE_BK4819);
 
 	BOARD_ADC_GetBatteryInfo(&gBatteryCurrentVoltage, &gBatteryCurrent);
 
 	BOARD_EEPROM_Init();
+	BOOT_STAMP(BOOT_PHASE_EEPROM);
 
 	BOARD_EEPROM_LoadCalibration();
-
-	RADIO_ConfigureChannel(0, VFO_CONFIGURE_RELOAD);
-	RADIO_ConfigureChannel(1, VFO_CONFIGURE_RELOAD);
+	BOOT_STAMP(BOOT_PHASE_CALIBRATION);
+
+	#ifdef ENABLE_STAGED_BOOT
+		// only the VFO the radio starts receiving on, BootBackground() does the other one. Not with cross band,
+		// which receives on the other VFO, or NOAA auto scan with dual watch, which looks at both before then
+		bBootVfoPending = (gEeprom.CROSS_BAND_RX_TX == CROSS_BAND_OFF);
+		#ifdef ENABLE_NOAA
+			bBootVfoPending = bBootVfoPending && (gEeprom.DUAL_WATCH == DUAL_WATCH_OFF || !gEeprom.NOAA_AUTO_SCAN);
+		#endif
+
+		if (bBootVfoPending)
+			RADIO_ConfigureChannel(gEeprom.TX_VFO, VFO_CONFIGURE_RELOAD);
+		else
+	#endif
+	{
+		RADIO_ConfigureChannel(0, VFO_CONFIGURE_RELOAD);
+		RADIO_ConfigureChannel(1, VFO_CONFIGURE_RELOAD);
+	}
 
 	RADIO_SelectVfos();
+	BOOT_STAMP(BOOT_PHASE_VFOS);
 
 	RADIO_SetupRegisters(true);
+	BOOT_STAMP(BOOT_PHASE_REGISTERS);
 
 	for (i = 0; i < ARRAY_SIZE(gBatteryVoltages); i++)
 		BOARD_ADC_GetBatteryInfo(&gBatteryVoltages[i], &gBatteryCurrent);
 
 	BATTERY_GetReadings(false);
+	BOOT_STAMP(BOOT_PHASE_BATTERY);
 
 	#ifdef ENABLE_AM_FIX
 		AM_fix_init();
@@ -150,11 +271,23 @@ void Main(void)
 	}
 	else
 	{
+		#ifdef ENABLE_STAGED_BOOT
+			// a normal boot leaves the welcome screen up from the main loop, see GUI_ServiceRedraw(),
+			// so the radio is receiving while it shows. Anything else still waits for it here
+			bool bHoldWelcome = (BootMode != BOOT_MODE_NORMAL);
+			#ifdef ENABLE_PWRON_PASSWORD
+				bHoldWelcome = bHoldWelcome || (gEeprom.POWER_ON_PASSWORD < 1000000);
+			#endif
+		#else
+			const bool bHoldWelcome = true;
+		#endif
+
 		UI_DisplayWelcome();
 
 		BACKLIGHT_TurnOn();
+		BOOT_STAMP(BOOT_PHASE_WELCOME);
 
-		if (gEeprom.POWER_ON_DISPLAY_MODE != POWER_ON_DISPLAY_MODE_NONE)
+		if (gEeprom.POWER_ON_DISPLAY_MODE != POWER_ON_DISPLAY_MODE_NONE && bHoldWelcome)
 		{	// 2.55 second boot-up screen
 			while (boot_counter_10ms > 0)
 			{
@@ -211,20 +344,77 @@ void Main(void)
 		// ******************
 	}
 
+	BOOT_STAMP(BOOT_PHASE_MAIN_LOOP);
+
+	#ifdef ENABLE_TASK_SCHEDULER
+		SCHEDULER_Start(&gTimeSlice500msTask, 50, 50);
+	#endif
+
+	#ifdef ENABLE_STAGED_BOOT
+		bool bBootBackgroundDone = false;
+	#else
+		BOOT_STAMP(BOOT_PHASE_BACKGROUND);
+		#ifdef ENABLE_BOOT_TIMING
+			BootReport();
+		#endif
+	#endif
+
 	while (1)
 	{
+		#ifdef ENABLE_LCD_DMA
+			ST7565_ServiceDma();
+		#endif
+
+		#ifdef ENABLE_STAGED_BOOT
+			if (!bBootBackgroundDone && BootBackground())
+			{
+				bBootBackgroundDone = true;
+
+				BOOT_STAMP(BOOT_PHASE_BACKGROUND);
+				#ifdef ENABLE_BOOT_TIMING
+					BootReport();
+				#endif
+			}
+		#endif
+
+		#ifdef ENABLE_EEPROM_WRITE_BEHIND
+			EEPROM_Service();
+		#endif
+
 		APP_Update();
 
 		if (gNextTimeslice)
 		{
 			APP_TimeSlice10ms();
 			gNextTimeslice = false;
-		}
 
-		if (gNextTimeslice_500ms)
-		{
-			APP_TimeSlice500ms();
-			gNextTimeslice_500ms = false;
+			#ifdef ENABLE_TASK_SCHEDULER
+				SCHEDULER_Dispatch();
+			#endif
 		}
+		#ifdef ENABLE_TASK_SCHEDULER
+			else
+			{	// APP_Update() has seen the last slice, nothing more to do until an interrupt
+				bool bBusy = false;
+
+				#ifdef ENABLE_LCD_DMA
+					bBusy = ST7565_IsDmaBusy();
+				#endif
+				#ifdef ENABLE_STAGED_BOOT
+					bBusy = bBusy || !bBootBackgroundDone;
+				#endif
+
+				__disable_irq();
+				if (!bBusy && !gNextTimeslice)
+					__WFI();   // a pending interrupt still wakes us with PRIMASK set
+				__enable_irq();
+			}
+		#else
+			if (gNextTimeslice_500ms)
+			{
+				APP_TimeSlice500ms();
+				gNextTimeslice_500ms = false;
+			}
+		#endif
 	}
 }
@@ -131,7 +131,9 @@ volatile bool     gNextTimeslice_500ms;
 volatile uint16_t gTxTimerCountdown_500ms;
 volatile bool     gTxTimeoutReached;
 
-volatile uint16_t gTailNoteEliminationCountdown_10ms;
+#ifndef ENABLE_TASK_SCHEDULER
+	volatile uint16_t gTailNoteEliminationCountdown_10ms;
+#endif
 
 volatile uint8_t    gVFOStateResumeCountdown_500ms;
 
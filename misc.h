@@ -196,7 +196,9 @@ extern volatile bool         gNextTimeslice_500ms;
 extern volatile uint16_t     gTxTimerCountdown_500ms;
 extern volatile bool         gTxTimeoutReached;
 
-extern volatile uint16_t     gTailNoteEliminationCountdown_10ms;
+#ifndef ENABLE_TASK_SCHEDULER
+	extern volatile uint16_t gTailNoteEliminationCountdown_10ms;
+#endif
 
 #ifdef ENABLE_FMRADIO
 	extern volatile uint16_t gFmPlayCountdown_10ms;
@@ -16,11 +16,15 @@
 
 #include <string.h>
 
+#ifdef ENABLE_SCAN_PLAN
+	#include "app/chFrScanner.h"
+#endif
 #include "app/dtmf.h"
 #ifdef ENABLE_FMRADIO
 	#include "app/fm.h"
 #endif
 #include "audio.h"
+#include "board.h"
 #include "bsp/dp32g030/gpio.h"
 #include "dcs.h"
 #include "driver/bk4819.h"
@@ -102,6 +106,41 @@ bool RADIO_CheckValidChannel(uint16_t Channel, bool bCheckScanList, uint8_t VFO)
 	return true;
 }
 
+#ifdef ENABLE_SCAN_PLAN
+	// the squelch rows of the current level and the TX power calibration, so a memory scan
+	// doesn't go to the EEPROM for them on every channel
+	static struct {
+		bool    bValid;
+		uint8_t SquelchLevel;
+		uint8_t Squelch[2][6];   // 0x1E00 (174MHz and up) and 0x1E60 rows, 0x10 apart
+		uint8_t Txp[7][3][3];    // [band][output power] from 0x1ED0
+	} gCalibration;
+
+	static bool CalibrationCached(void)
+	{	// ui.c can end a scan without CHFRSCANNER_Stop(), so check the scan is still on
+		return gCalibration.bValid && gScanStateDir != SCAN_OFF && gCalibration.SquelchLevel == gEeprom.SQUELCH_LEVEL;
+	}
+
+	void RADIO_CacheCalibration(const bool bEnable)
+	{
+		if (!bEnable)
+		{
+			gCalibration.bValid = false;
+			return;
+		}
+
+		if (gCalibration.bValid && gCalibration.SquelchLevel == gEeprom.SQUELCH_LEVEL)
+			return;
+
+		EEPROM_ReadRecords(0x1E00 + gEeprom.SQUELCH_LEVEL, 0x10, gCalibration.Squelch[0], 1, 1, 6);
+		EEPROM_ReadRecords(0x1E60 + gEeprom.SQUELCH_LEVEL, 0x10, gCalibration.Squelch[1], 1, 1, 6);
+		EEPROM_ReadRecords(0x1ED0, 16, gCalibration.Txp, sizeof(gCalibration.Txp[0]), sizeof(gCalibration.Txp[0]), ARRAY_SIZE(gCalibration.Txp));
+
+		gCalibration.SquelchLevel = gEeprom.SQUELCH_LEVEL;
+		gCalibration.bValid       = true;
+	}
+#endif
+
 uint8_t RADIO_FindNextChannel(uint8_t Channel, int8_t Direction, bool bCheckScanList, uint8_t VFO)
 {
 	unsigned int i;
@@ -256,6 +295,11 @@ void RADIO_ConfigureChannel(const unsigned int VFO, const unsigned int configure
 
 		// ***************
 
+		#ifdef ENABLE_CHANNEL_TABLE
+			if (IS_IN_CHANNEL_TABLE(Channel))
+				memcpy(Data, gChannelTable[Channel].Data, sizeof(Data));
+			else
+		#endif
 		EEPROM_ReadBuffer(Base + 8, Data, sizeof(Data));
 
 		Tmp = Data[3] & 0x0F;
@@ -357,6 +401,14 @@ void RADIO_ConfigureChannel(const unsigned int VFO, const unsigned int configure
 			uint32_t Offset;
 		} __attribute__((packed)) Info;
 
+		#ifdef ENABLE_CHANNEL_TABLE
+			if (IS_IN_CHANNEL_TABLE(Channel))
+			{
+				Info.Frequency = gChannelTable[Channel].Frequency;
+				Info.Offset    = gChannelTable[Channel].Offset;
+			}
+			else
+		#endif
 		EEPROM_ReadBuffer(Base, &Info, sizeof(Info));
 
 		pRadio->freq_config_RX.Frequency = Info.Frequency;
@@ -452,16 +504,32 @@ void RADIO_ConfigureSquelchAndOutputPower(VFO_Info_t *pInfo)
 	}
 	else
 	{	// squelch >= 1
-		Base += gEeprom.SQUELCH_LEVEL;                                        // my eeprom squelch-1
-																			  // VHF   UHF
-		EEPROM_ReadBuffer(Base + 0x00, &pInfo->SquelchOpenRSSIThresh,    1);  //  50    10
-		EEPROM_ReadBuffer(Base + 0x10, &pInfo->SquelchCloseRSSIThresh,   1);  //  40     5
+		#ifdef ENABLE_SCAN_PLAN
+			if (CalibrationCached())
+			{
+				const uint8_t *pSquelch = gCalibration.Squelch[(Band < BAND4_174MHz) ? 1 : 0];
+
+				pInfo->SquelchOpenRSSIThresh    = pSquelch[0];
+				pInfo->SquelchCloseRSSIThresh   = pSquelch[1];
+				pInfo->SquelchOpenNoiseThresh   = pSquelch[2];
+				pInfo->SquelchCloseNoiseThresh  = pSquelch[3];
+				pInfo->SquelchCloseGlitchThresh = pSquelch[4];
+				pInfo->SquelchOpenGlitchThresh  = pSquelch[5];
+			}
+			else
+		#endif
+		{
+			Base += gEeprom.SQUELCH_LEVEL;                                        // my eeprom squelch-1
+																				  // VHF   UHF
+			EEPROM_ReadBuffer(Base + 0x00, &pInfo->SquelchOpenRSSIThresh,    1);  //  50    10
+			EEPROM_ReadBuffer(Base + 0x10, &pInfo->SquelchCloseRSSIThresh,   1);  //  40     5
 
-		EEPROM_ReadBuffer(Base + 0x20, &pInfo->SquelchOpenNoiseThresh,   1);  //  65    90
-		EEPROM_ReadBuffer(Base + 0x30, &pInfo->SquelchCloseNoiseThresh,  1);  //  70   100
+			EEPROM_ReadBuffer(Base + 0x20, &pInfo->SquelchOpenNoiseThresh,   1);  //  65    90
+			EEPROM_ReadBuffer(Base + 0x30, &pInfo->SquelchCloseNoiseThresh,  1);  //  70   100
 
-		EEPROM_ReadBuffer(Base + 0x40, &pInfo->SquelchCloseGlitchThresh, 1);  //  90    90
-		EEPROM_ReadBuffer(Base + 0x50, &pInfo->SquelchOpenGlitchThresh,  1);  // 100   100
+			EEPROM_ReadBuffer(Base + 0x40, &pInfo->SquelchCloseGlitchThresh, 1);  //  90    90
+			EEPROM_ReadBuffer(Base + 0x50, &pInfo->SquelchOpenGlitchThresh,  1);  // 100   100
+		}
 
 		uint16_t rssi_open    = pInfo->SquelchOpenRSSIThresh;
 		uint16_t rssi_close   = pInfo->SquelchCloseRSSIThresh;
@@ -520,6 +588,11 @@ void RADIO_ConfigureSquelchAndOutputPower(VFO_Info_t *pInfo)
 	
 	Band = FREQUENCY_GetBand(pInfo->pTX->Frequency);
 
+	#ifdef ENABLE_SCAN_PLAN
+		if (CalibrationCached())
+			memcpy(Txp, gCalibration.Txp[Band][pInfo->OUTPUT_POWER], sizeof(Txp));
+		else
+	#endif
 	EEPROM_ReadBuffer(0x1ED0 + (Band * 16) + (pInfo->OUTPUT_POWER * 3), Txp, 3);
 
 
@@ -637,6 +710,10 @@ void RADIO_SetupRegisters(bool switchToForeground)
 		BK4819_WriteRegister(BK4819_REG_02, 0);
 		SYSTEM_DelayMs(1);
 	}
+	#ifdef ENABLE_BK4819_IRQ_QUEUE
+		// and whatever the systick poll already took from the chip
+		BK4819_FlushInterrupts();
+	#endif
 	BK4819_WriteRegister(BK4819_REG_3F, 0);
 
 	// mic gain 0.5dB/step 0 to 31
@@ -673,6 +750,9 @@ void RADIO_SetupRegisters(bool switchToForeground)
 
 	InterruptMask = BK4819_REG_3F_SQUELCH_FOUND | BK4819_REG_3F_SQUELCH_LOST;
 
+	// the scramble, VOX and compander settings below all share REG_31, send it once at the end
+	BK4819_BeginBatch();
+
 	#ifdef ENABLE_NOAA
 		if (!IS_NOAA_CHANNEL(gRxVfo->CHANNEL_SAVE))
 	#endif
@@ -770,6 +850,8 @@ void RADIO_SetupRegisters(bool switchToForeground)
 	// RX expander
 	BK4819_SetCompander((gRxVfo->Modulation == MODULATION_FM && gRxVfo->Compander >= 2) ? gRxVfo->Compander : 0);
 
+	BK4819_CommitBatch();
+
 	#if 0
 		if (!gRxVfo->DTMF_DECODING_ENABLE && !gSetting_KILLED)
 		{
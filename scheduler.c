@@ -23,11 +23,20 @@
 #include "functions.h"
 #include "helper/battery.h"
 #include "misc.h"
+#include "scheduler.h"
 #include "settings.h"
 
 #include "driver/backlight.h"
+#if defined(ENABLE_BK4819_IRQ_QUEUE) || defined(ENABLE_TICKLESS_IDLE)
+	#include "driver/bk4819.h"
+#endif
 #include "bsp/dp32g030/gpio.h"
 #include "driver/gpio.h"
+#ifdef ENABLE_TICKLESS_IDLE
+	#include "driver/keyboard.h"
+#endif
+#include "driver/systick.h"
+#include "ARMCM0.h"
 
 #define DECREMENT(cnt) \
 	do {               \
@@ -44,22 +53,152 @@
 
 static volatile uint32_t gGlobalSysTickCounter;
 
-void SystickHandler(void);
+// systick periods of SYSTICK_TICK_US gone by, a stretched period counts as several
+static volatile uint32_t gSysTickInterrupts;
 
-// we come here every 10ms
-void SystickHandler(void)
+#ifdef ENABLE_TICKLESS_IDLE
+	// longest systick period while the radio sleeps in power save, bounds the key response from sleep
+	#define TICKLESS_MAX_10MS   5u
+
+	#define TICKLESS_LOAD(Stretch_10ms) \
+		((((Stretch_10ms) > 0) ? ((Stretch_10ms) * 10000u) : SYSTICK_TICK_US) * SYSTICK_CPU_MHZ - 1u)
+
+	// 10ms ticks in the period being counted now and in the one LOAD holds for after it, 0 = an ordinary tick
+	static volatile uint8_t gStretchRunning;
+	static volatile uint8_t gStretchLoaded;
+#endif
+
+uint32_t SCHEDULER_GetUptimeUs(void)
+{
+	uint32_t Ticks;
+	uint32_t Count;
+	uint32_t Load;
+
+	do {	// read again if the tick interrupt came in between
+		Ticks = gSysTickInterrupts;
+		Count = SysTick->VAL;
+		#ifdef ENABLE_TICKLESS_IDLE
+			Load = TICKLESS_LOAD(gStretchRunning);   // LOAD may already hold the next period
+		#else
+			Load = SysTick->LOAD;
+		#endif
+	} while (Ticks != gSysTickInterrupts);
+
+	return (Ticks * SYSTICK_TICK_US) + ((Load - Count) / SYSTICK_CPU_MHZ);
+}
+
+#ifdef ENABLE_TASK_SCHEDULER
+	// one list per slot, a task sits in slot (Deadline % size) until its deadline comes round
+	#define SCHEDULER_WHEEL_SIZE 16u
+	#define SCHEDULER_WHEEL_MASK (SCHEDULER_WHEEL_SIZE - 1u)
+
+	static SCHEDULER_Task_t *gWheel[SCHEDULER_WHEEL_SIZE];
+	static uint32_t          gDispatchedTick;
+
+	static void Insert(SCHEDULER_Task_t *pTask, const uint32_t Deadline)
+	{
+		SCHEDULER_Task_t **ppTask = &gWheel[Deadline & SCHEDULER_WHEEL_MASK];
+
+		// keep the slot sorted by priority, first come first served within one priority
+		while (*ppTask != NULL && (*ppTask)->Priority >= pTask->Priority)
+			ppTask = &(*ppTask)->pNext;
+
+		pTask->Deadline = Deadline;
+		pTask->pNext    = *ppTask;
+		pTask->bArmed   = true;
+		*ppTask         = pTask;
+	}
+
+	void SCHEDULER_Start(SCHEDULER_Task_t *pTask, uint16_t Delay_10ms, uint16_t Period_10ms)
+	{
+		uint32_t Deadline = gGlobalSysTickCounter + Delay_10ms;
+
+		SCHEDULER_Stop(pTask);
+
+		// ticks up to gDispatchedTick have been walked already
+		if ((int32_t)(Deadline - gDispatchedTick) <= 0)
+			Deadline = gDispatchedTick + 1;
+
+		pTask->Period = Period_10ms;
+		Insert(pTask, Deadline);
+	}
+
+	void SCHEDULER_Stop(SCHEDULER_Task_t *pTask)
+	{
+		SCHEDULER_Task_t **ppTask;
+
+		if (!pTask->bArmed)
+			return;
+
+		for (ppTask = &gWheel[pTask->Deadline & SCHEDULER_WHEEL_MASK]; *ppTask != NULL; ppTask = &(*ppTask)->pNext)
+		{
+			if (*ppTask == pTask)
+			{
+				*ppTask = pTask->pNext;
+				break;
+			}
+		}
+
+		pTask->bArmed = false;
+	}
+
+	void SCHEDULER_Dispatch(void)
+	{
+		const uint32_t Now = gGlobalSysTickCounter;
+
+		while (gDispatchedTick != Now)
+		{
+			const uint32_t     Tick   = ++gDispatchedTick;
+			SCHEDULER_Task_t **ppTask = &gWheel[Tick & SCHEDULER_WHEEL_MASK];
+
+			while (*ppTask != NULL)
+			{
+				SCHEDULER_Task_t *pTask = *ppTask;
+
+				if (pTask->Deadline != Tick)
+				{	// due on a later turn of the wheel
+					ppTask = &pTask->pNext;
+					continue;
+				}
+
+				*ppTask       = pTask->pNext;
+				pTask->bArmed = false;
+
+				if (pTask->Period > 0)
+				{	// re-arm before the callback so it can stop or restart itself,
+					// a periodic task runs once however late the main loop was
+					uint32_t Deadline = Tick + pTask->Period;
+
+					if ((int32_t)(Deadline - Now) <= 0)
+						Deadline = Now + pTask->Period;
+
+					Insert(pTask, Deadline);
+				}
+
+				pTask->Callback();
+
+				// the callback may have started or stopped tasks in this slot
+				ppTask = &gWheel[Tick & SCHEDULER_WHEEL_MASK];
+			}
+		}
+	}
+#endif
+
+static void Tick10ms(void)
 {
 	gGlobalSysTickCounter++;
 	
 	gNextTimeslice = true;
 
-	if ((gGlobalSysTickCounter % 50) == 0)
-	{
-		gNextTimeslice_500ms = true;
-		
-		DECREMENT_AND_TRIGGER(gTxTimerCountdown_500ms, gTxTimeoutReached);
-		DECREMENT(gSerialConfigCountDown_500ms);
-	}
+	#ifndef ENABLE_TASK_SCHEDULER
+		if ((gGlobalSysTickCounter % 50) == 0)
+		{
+			gNextTimeslice_500ms = true;
+			
+			DECREMENT_AND_TRIGGER(gTxTimerCountdown_500ms, gTxTimeoutReached);
+			DECREMENT(gSerialConfigCountDown_500ms);
+		}
+	#endif
 
 	if ((gGlobalSysTickCounter & 3) == 0)
 		gNextTimeslice40ms = true;
@@ -93,10 +232,12 @@ void SystickHandler(void)
 		if (gCurrentFunction != FUNCTION_MONITOR && gCurrentFunction != FUNCTION_TRANSMIT)
 			DECREMENT_AND_TRIGGER(gScanPauseDelayIn_10ms, gScheduleScanListen);
 
-	DECREMENT_AND_TRIGGER(gTailNoteEliminationCountdown_10ms, gFlagTailNoteEliminationComplete);
+	#ifndef ENABLE_TASK_SCHEDULER
+		DECREMENT_AND_TRIGGER(gTailNoteEliminationCountdown_10ms, gFlagTailNoteEliminationComplete);
 
-	#ifdef ENABLE_VOICE
-		DECREMENT_AND_TRIGGER(gCountdownToPlayNextVoice_10ms, gFlagPlayQueuedVoice);
+		#ifdef ENABLE_VOICE
+			DECREMENT_AND_TRIGGER(gCountdownToPlayNextVoice_10ms, gFlagPlayQueuedVoice);
+		#endif
 	#endif
 	
 	#ifdef ENABLE_FMRADIO
@@ -111,3 +252,79 @@ void SystickHandler(void)
 
 	DECREMENT(boot_counter_10ms);
 }
+
+#ifdef ENABLE_TICKLESS_IDLE
+	static void StretchNextPeriod(void)
+	{	// the counter reloaded for the period after this interrupt already, LOAD sets the one after that
+		uint8_t Stretch = 0;
+
+		if (gCurrentFunction == FUNCTION_POWER_SAVE && gRxIdleMode && gSerialConfigCountDown_500ms == 0 &&
+		    gKeyReading0 == KEY_INVALID && gKeyReading1 == KEY_INVALID && !gPttIsPressed && gPttDebounceCounter == 0)
+		{	// BK4819 is asleep and nobody touches the keys, wake up just in time to turn RX back on
+			const uint16_t Running = (gStretchRunning > 0) ? gStretchRunning : (SYSTICK_TICK_US / 10000u);
+
+			if (gPowerSave_10ms > Running + 1u)
+				Stretch = MIN((unsigned int)(gPowerSave_10ms - Running), TICKLESS_MAX_10MS);
+		}
+
+		if (Stretch != gStretchLoaded)
+		{
+			gStretchLoaded = Stretch;
+			SysTick->LOAD  = TICKLESS_LOAD(Stretch);
+		}
+	}
+
+	void SCHEDULER_EndTicklessIdle(void)
+	{
+		__disable_irq();
+		if (gStretchLoaded > 0)
+		{
+			gStretchLoaded = 0;
+			SysTick->LOAD  = TICKLESS_LOAD(0);
+		}
+		__enable_irq();
+	}
+#endif
+
+// we come here every 10ms (every 1ms with ENABLE_BK4819_IRQ_QUEUE, every few 10ms in power save with ENABLE_TICKLESS_IDLE)
+void SystickHandler(void)
+{
+	#ifdef ENABLE_TICKLESS_IDLE
+		const uint8_t Stretch = gStretchRunning;
+
+		gStretchRunning = gStretchLoaded;
+
+		if (Stretch > 0)
+		{	// a stretched period ended, catch the 10ms work up with it, the 1ms sub-tick phase is unchanged
+			unsigned int i;
+
+			gSysTickInterrupts += Stretch * (10000u / SYSTICK_TICK_US);
+
+			for (i = 0; i < Stretch; i++)
+				Tick10ms();
+
+			StretchNextPeriod();
+			return;
+		}
+	#endif
+
+	gSysTickInterrupts++;
+
+	#ifdef ENABLE_BK4819_IRQ_QUEUE
+		static uint8_t SubTick_1ms;
+
+		// same conditions the main loop used for polling the chip
+		if (!gReducedService && !SCANNER_IsScanning() && (gCurrentFunction != FUNCTION_POWER_SAVE || !gRxIdleMode))
+			BK4819_PollInterrupts();
+
+		if (++SubTick_1ms < 10)
+			return;
+		SubTick_1ms = 0;
+	#endif
+
+	Tick10ms();
+
+	#ifdef ENABLE_TICKLESS_IDLE
+		StretchNextPeriod();
+	#endif
+}
@@ -0,0 +1,62 @@
+/* Copyright 2023 Dual Tachyon
+ * https://github.com/DualTachyon
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+void     SystickHandler(void);
+
+// time since SYSTICK_Init() in us, wraps after about 71 minutes
+uint32_t SCHEDULER_GetUptimeUs(void);
+
+#ifdef ENABLE_TASK_SCHEDULER
+	// timer wheel run from the main loop, the systick interrupt only counts 10ms ticks
+
+	enum {
+		SCHEDULER_PRIORITY_LOW = 0,
+		SCHEDULER_PRIORITY_NORMAL,
+		SCHEDULER_PRIORITY_HIGH
+	};
+
+	typedef void (*SCHEDULER_Callback_t)(void);
+
+	typedef struct SCHEDULER_Task_t {
+		struct SCHEDULER_Task_t *pNext;
+		SCHEDULER_Callback_t     Callback;
+		uint32_t                 Deadline;   // 10ms tick
+		uint16_t                 Period;     // 10ms ticks, 0 = one shot
+		uint8_t                  Priority;   // tasks due on the same tick run highest first
+		bool                     bArmed;
+	} SCHEDULER_Task_t;
+
+	#define SCHEDULER_TASK(callback, priority) { NULL, (callback), 0, 0, (priority), false }
+
+	// (re)arm a task to run Delay_10ms ticks from now, then every Period_10ms ticks if not 0
+	void SCHEDULER_Start(SCHEDULER_Task_t *pTask, uint16_t Delay_10ms, uint16_t Period_10ms);
+	void SCHEDULER_Stop(SCHEDULER_Task_t *pTask);
+	void SCHEDULER_Dispatch(void);
+#endif
+
+#ifdef ENABLE_TICKLESS_IDLE
+	// back to the ordinary tick from the next systick reload on, for leaving power save
+	void SCHEDULER_EndTicklessIdle(void);
+#endif
+
+#endif
@@ -19,6 +19,7 @@
 #ifdef ENABLE_FMRADIO
 	#include "app/fm.h"
 #endif
+#include "board.h"
 #include "driver/eeprom.h"
 #include "driver/uart.h"
 #include "misc.h"
@@ -188,6 +189,16 @@ void SETTINGS_SaveSettings(void)
 	EEPROM_WriteBuffer(0x0F40, State);
 }
 
+static void WriteChannelData(const uint16_t Offset, const uint8_t *pData)
+{
+	EEPROM_WriteBuffer(Offset, pData);
+
+	#ifdef ENABLE_CHANNEL_TABLE
+		if (Offset < sizeof(gChannelTable))   // a memory channel record, not a VFO or a name
+			BOARD_UpdateChannelTable(Offset, pData);
+	#endif
+}
+
 void SETTINGS_SaveChannel(uint8_t Channel, uint8_t VFO, const VFO_Info_t *pVFO, uint8_t Mode)
 {
 	#ifdef ENABLE_NOAA
@@ -210,7 +221,7 @@ void SETTINGS_SaveChannel(uint8_t Channel, uint8_t VFO, const VFO_Info_t *pVFO,
 
 			((uint32_t *)State)[0] = pVFO->freq_config_RX.Frequency;
 			((uint32_t *)State)[1] = pVFO->TX_OFFSET_FREQUENCY;
-			EEPROM_WriteBuffer(OffsetVFO + 0, State);
+			WriteChannelData(OffsetVFO + 0, State);
 
 			State[0] =  pVFO->freq_config_RX.Code;
 			State[1] =  pVFO->freq_config_TX.Code;
@@ -224,7 +235,7 @@ void SETTINGS_SaveChannel(uint8_t Channel, uint8_t VFO, const VFO_Info_t *pVFO,
 			State[5] = ((pVFO->DTMF_PTT_ID_TX_MODE & 7u) << 1) | ((pVFO->DTMF_DECODING_ENABLE & 1u) << 0);
 			State[6] =  pVFO->STEP_SETTING;
 			State[7] =  pVFO->SCRAMBLING_TYPE;
-			EEPROM_WriteBuffer(OffsetVFO + 8, State);
+			WriteChannelData(OffsetVFO + 8, State);
 
 			SETTINGS_UpdateChannel(Channel, pVFO, true);
 
@@ -235,17 +246,17 @@ void SETTINGS_SaveChannel(uint8_t Channel, uint8_t VFO, const VFO_Info_t *pVFO,
 					// clear/reset the channel name
 					//memset(&State, 0xFF, sizeof(State));
 					memset(&State, 0x00, sizeof(State));     // follow the QS way
-					EEPROM_WriteBuffer(0x0F50 + OffsetMR, State);
-					EEPROM_WriteBuffer(0x0F58 + OffsetMR, State);
+					WriteChannelData(0x0F50 + OffsetMR, State);
+					WriteChannelData(0x0F58 + OffsetMR, State);
 				#else
 					if (Mode >= 3)
 					{	// save the channel name
 						memmove(State, pVFO->Name + 0, 8);
-						EEPROM_WriteBuffer(0x0F50 + OffsetMR, State);
+						WriteChannelData(0x0F50 + OffsetMR, State);
 						//memset(State, 0xFF, sizeof(State));
 						memset(State, 0x00, sizeof(State));  // follow the QS way
 						memmove(State, pVFO->Name + 8, 2);
-						EEPROM_WriteBuffer(0x0F58 + OffsetMR, State);
+						WriteChannelData(0x0F58 + OffsetMR, State);
 					}
 				#endif
 			}
@@ -299,8 +310,8 @@ void SETTINGS_UpdateChannel(uint8_t Channel, const VFO_Info_t *pVFO, bool keep)
 				{	// clear/reset the channel name
 					//memset(&State, 0xFF, sizeof(State));
 					memset(&State, 0x00, sizeof(State));   // follow the QS way
-					EEPROM_WriteBuffer(0x0F50 + OffsetMR, State);
-					EEPROM_WriteBuffer(0x0F58 + OffsetMR, State);
+					WriteChannelData(0x0F50 + OffsetMR, State);
+					WriteChannelData(0x0F58 + OffsetMR, State);
 				}
 //				else
 //				{	// update the channel name
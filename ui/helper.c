@@ -16,6 +16,8 @@
 
 #include <string.h>
 
+#include "board.h"
+#include "driver/eeprom.h"
 #include "driver/st7565.h"
 #include "external/printf/printf.h"
 #include "font.h"
@@ -27,6 +29,29 @@
 	#define ARRAY_SIZE(arr) (sizeof(arr)/sizeof((arr)[0]))
 #endif
 
+bool UI_IsTextCached(const cached_text_t *p, const uint32_t key)
+{
+	return p->valid && p->key == key && p->eeprom_write_count == gEepromWriteCount;
+}
+
+void UI_SetTextCached(cached_text_t *p, const uint32_t key)
+{
+	p->valid              = true;
+	p->key                = key;
+	p->eeprom_write_count = gEepromWriteCount;
+}
+
+const char *UI_GetCachedChannelName(cached_text_t *p, const uint8_t channel)
+{	// the name is only read from the EEPROM when the channel changes or the EEPROM was written
+	if (!UI_IsTextCached(p, channel))
+	{
+		BOARD_fetchChannelName(p->text, channel);
+		UI_SetTextCached(p, channel);
+	}
+
+	return p->text;
+}
+
 void UI_GenerateChannelString(char *pString, const uint8_t Channel)
 {
 	unsigned int i;
@@ -64,9 +89,66 @@ void UI_GenerateChannelStringEx(char *pString, const bool bShowPrefix, const uin
 }
 
 
+static int FindCNGlyph(const char *pString)
+{	// binary search the sorted UTF-8 -> glyph table, -1 if we don't have the glyph
+	unsigned int low  = 0;
+	unsigned int high = CNIndexCount;
+
+	if ((pString[0] & 0xF0) != 0xE0 || pString[1] == 0 || pString[2] == 0)
+		return -1;   // not the lead byte of a 3-byte UTF-8 sequence
+
+	const uint32_t key = ((uint32_t)(uint8_t)pString[0] << 16) | ((uint32_t)(uint8_t)pString[1] << 8) | (uint8_t)pString[2];
+
+	while (low < high)
+	{
+		const unsigned int mid = (low + high) / 2;
+		const uint32_t     k   = CNIndex[mid] >> 8;
+
+		if (k == key)
+			return CNIndex[mid] & 0xFF;
+
+		if (k < key)
+			low = mid + 1;
+		else
+			high = mid;
+	}
+
+	return -1;
+}
+
+#ifdef ENABLE_PACKED_CN_FONT
+	static void UnpackCNGlyph(const uint8_t *pPacked, const unsigned int Glyph, const unsigned int Width, const unsigned int Height, uint8_t *pLine0, uint8_t *pLine1)
+	{	// each column is 'Height' bits, rows 0-7 go to pLine0 and the rest to pLine1
+		const unsigned int Offset = Glyph * Width * Height;
+		const uint8_t     *p      = pPacked + (Offset / 8);
+		uint32_t           Bits   = *p++ >> (Offset % 8);
+		unsigned int       Avail  = 8 - (Offset % 8);
+		unsigned int       i;
+
+		for (i = 0; i < Width; i++)
+		{
+			uint32_t Column;
+
+			while (Avail < Height)
+			{
+				Bits  |= (uint32_t)*p++ << Avail;
+				Avail += 8;
+			}
+
+			Column = Bits & ((1u << Height) - 1);
+			Bits >>= Height;
+			Avail -= Height;
+
+			pLine0[i] = (uint8_t)Column;
+			if (pLine1 != NULL)
+				pLine1[i] = (uint8_t)(Column >> 8);
+		}
+	}
+#endif
+
 void UI_PrintString(const char *pString, uint8_t Start, uint8_t End, uint8_t Line, uint8_t Width)
 {
-	size_t i, j;
+	size_t i;
 	size_t Length = strlen(pString);
 	size_t ofs_fix = 0;
 
@@ -87,15 +169,18 @@ void UI_PrintString(const char *pString, uint8_t Start, uint8_t End, uint8_t Lin
 		else
 		if (pString[i] > 127)
 		{
-			for (j = 0; j< strlen(CNList)/3; j++)
-				if (pString[i]==CNList[3*j] && pString[i+1]==CNList[3*j+1] && pString[i+2]==CNList[3*j+2])
-				{
-					memmove(gFrameBuffer[Line + 0] + ofs, &CNFont14[j][0], 14);
-					memmove(gFrameBuffer[Line + 1] + ofs, &CNFont14[j][14], 14);
-					i+=2;
-					ofs_fix++;
-					break;
-				}
+			const int glyph = FindCNGlyph(pString + i);
+			if (glyph >= 0)
+			{
+				#ifdef ENABLE_PACKED_CN_FONT
+					UnpackCNGlyph(CNFont14Packed, glyph, 14, 14, gFrameBuffer[Line + 0] + ofs, gFrameBuffer[Line + 1] + ofs);
+				#else
+					memmove(gFrameBuffer[Line + 0] + ofs, &CNFont14[glyph][0], 14);
+					memmove(gFrameBuffer[Line + 1] + ofs, &CNFont14[glyph][14], 14);
+				#endif
+				i+=2;
+				ofs_fix++;
+			}
 		}
 	}
 }
@@ -103,7 +188,7 @@ void UI_PrintString(const char *pString, uint8_t Start, uint8_t End, uint8_t Lin
 void UI_PrintStringSmall(const char *pString, uint8_t Start, uint8_t End, uint8_t Line)
 {
 	const size_t Length = strlen(pString);
-	size_t       i, j;
+	size_t       i;
 
 	if (End > Start)
 		Start += (((End - Start) - (Length * 8)) + 1) / 2;
@@ -117,12 +202,16 @@ void UI_PrintStringSmall(const char *pString, uint8_t Start, uint8_t End, uint8_
 		{
 			if (pString[i] > 127)
 			{
-				for (j = 0; j< strlen(CNList)/3; j++)
-					if (pString[i]==CNList[3*j] && pString[i+1]==CNList[3*j+1] && pString[i+2]==CNList[3*j+2])
-					{
-						memmove(pFb + (i * char_spacing) + 1, &CNFont6[j], char_width);
-						break;
-					}
+				const int glyph = FindCNGlyph(pString + i);
+				if (glyph >= 0)
+				{	// the glyph keeps all 3 char cells, as before
+					#ifdef ENABLE_PACKED_CN_FONT
+						UnpackCNGlyph(CNFont6Packed, glyph, 6, 6, pFb + (i * char_spacing) + 1, NULL);
+					#else
+						memmove(pFb + (i * char_spacing) + 1, &CNFont6[glyph], char_width);
+					#endif
+					i += 2;
+				}
 				continue;
 			}
 			const unsigned int index = (unsigned int)pString[i] - ' ' - 1;
@@ -158,10 +247,11 @@ void UI_PrintStringSmall(const char *pString, uint8_t Start, uint8_t End, uint8_
 
 void UI_PrintStringSmallBuffer(const char *pString, uint8_t *buffer)
 {
+	const size_t Length = strlen(pString);
 	size_t i;
 	const unsigned int char_width   = ARRAY_SIZE(gFontSmall[0]);
 	const unsigned int char_spacing = char_width + 1;
-	for (i = 0; i < strlen(pString); i++)
+	for (i = 0; i < Length; i++)
 	{
 		if (pString[i] > ' ')
 		{
@@ -172,6 +262,80 @@ void UI_PrintStringSmallBuffer(const char *pString, uint8_t *buffer)
 	}
 }
 
+#ifdef ENABLE_MENU_GLYPHS
+	void UI_PrintGlyphString(const uint8_t *pGlyphs, uint8_t Start, uint8_t End, uint8_t Line, uint8_t Width)
+	{	// same layout as UI_PrintString gives the UTF-8 text the glyphs came from
+		const size_t Length = pGlyphs[0];
+		unsigned int Cell   = 0;   // byte position in the UTF-8 text
+		unsigned int CNRun  = 0;   // Chinese glyphs since the last ASCII one, each of them takes a cell less
+		unsigned int i;
+
+		if (End > Start)
+			Start += (((End - Start) - (Length * Width)) + 1) / 2;
+
+		for (i = 1; i < UI_GLYPH_STRING_SIZE && pGlyphs[i] != 0; i++)
+		{
+			const unsigned int Glyph = pGlyphs[i];
+			const unsigned int ofs   = (unsigned int)Start + ((Cell - CNRun) * Width);
+
+			if (Glyph >= UI_GLYPH_CN(0))
+			{
+				#ifdef ENABLE_PACKED_CN_FONT
+					UnpackCNGlyph(CNFont14Packed, Glyph - UI_GLYPH_CN(0), 14, 14, gFrameBuffer[Line + 0] + ofs, gFrameBuffer[Line + 1] + ofs);
+				#else
+					memmove(gFrameBuffer[Line + 0] + ofs, &CNFont14[Glyph - UI_GLYPH_CN(0)][0], 14);
+					memmove(gFrameBuffer[Line + 1] + ofs, &CNFont14[Glyph - UI_GLYPH_CN(0)][14], 14);
+				#endif
+				Cell += 3;
+				CNRun++;
+				continue;
+			}
+
+			if (Glyph > UI_GLYPH_ASCII(' '))
+			{
+				const unsigned int index = Glyph - UI_GLYPH_ASCII(' ') - 1;
+				memmove(gFrameBuffer[Line + 0] + ofs, &gFontBig[index][0], 7);
+				memmove(gFrameBuffer[Line + 1] + ofs, &gFontBig[index][7], 7);
+				CNRun = 0;
+			}
+			Cell++;
+		}
+	}
+
+	void UI_PrintGlyphStringSmall(const uint8_t *pGlyphs, uint8_t Start, uint8_t End, uint8_t Line)
+	{	// same layout as UI_PrintStringSmall
+		const size_t       Length       = pGlyphs[0];
+		const unsigned int char_width   = ARRAY_SIZE(gFontSmall[0]);
+		const unsigned int char_spacing = char_width + 1;
+		unsigned int       Cell         = 0;
+		unsigned int       i;
+
+		if (End > Start)
+			Start += (((End - Start) - (Length * 8)) + 1) / 2;
+
+		uint8_t *pFb = gFrameBuffer[Line] + Start;
+		for (i = 1; i < UI_GLYPH_STRING_SIZE && pGlyphs[i] != 0; i++)
+		{
+			const unsigned int Glyph = pGlyphs[i];
+
+			if (Glyph >= UI_GLYPH_CN(0))
+			{	// the glyph keeps all 3 char cells
+				#ifdef ENABLE_PACKED_CN_FONT
+					UnpackCNGlyph(CNFont6Packed, Glyph - UI_GLYPH_CN(0), 6, 6, pFb + (Cell * char_spacing) + 1, NULL);
+				#else
+					memmove(pFb + (Cell * char_spacing) + 1, &CNFont6[Glyph - UI_GLYPH_CN(0)], char_width);
+				#endif
+				Cell += 3;
+				continue;
+			}
+
+			if (Glyph > UI_GLYPH_ASCII(' '))
+				memmove(pFb + (Cell * char_spacing) + 1, &gFontSmall[Glyph - UI_GLYPH_ASCII(' ') - 1], char_width);
+			Cell++;
+		}
+	}
+#endif
+
 void UI_DisplayFrequency(const char *string, uint8_t X, uint8_t Y, bool center)
 {
 	const unsigned int char_width  = 13;
@@ -20,6 +20,20 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+// text that costs EEPROM reads to build, kept until its key changes or the EEPROM is written
+typedef struct
+{
+	bool     valid;
+	bool     found;
+	uint16_t eeprom_write_count;
+	uint32_t key;
+	char     text[16];
+} cached_text_t;
+
+bool UI_IsTextCached(const cached_text_t *p, const uint32_t key);
+void UI_SetTextCached(cached_text_t *p, const uint32_t key);
+const char *UI_GetCachedChannelName(cached_text_t *p, const uint8_t channel);
+
 void UI_GenerateChannelString(char *pString, const uint8_t Channel);
 void UI_GenerateChannelStringEx(char *pString, const bool bShowPrefix, const uint8_t ChannelNumber);
 void UI_PrintString(const char *pString, uint8_t Start, uint8_t End, uint8_t Line, uint8_t Width);
@@ -29,6 +43,16 @@ void UI_PrintStringSmall(const char *pString, uint8_t Start, uint8_t End, uint8_
 	void UI_PrintStringSmallBold(const char *pString, uint8_t Start, uint8_t End, uint8_t Line);
 #endif
 void UI_PrintStringSmallBuffer(const char *pString, uint8_t *buffer);
+#ifdef ENABLE_MENU_GLYPHS
+	// text already decoded to glyphs by utils/main.cpp: byte 0 is the length the text has in UTF-8
+	// (the centering and the character cells still work in bytes), then up to 6 glyph codes, 0 ends early
+	#define UI_GLYPH_STRING_SIZE   7
+	#define UI_GLYPH_ASCII(c)      ((c) - ' ' + 1)      // 0x01 - 0x5F, ' ' to '~'
+	#define UI_GLYPH_CN(n)         (0x60 + (n))         // glyph n of CNFont14/CNFont6
+
+	void UI_PrintGlyphString(const uint8_t *pGlyphs, uint8_t Start, uint8_t End, uint8_t Line, uint8_t Width);
+	void UI_PrintGlyphStringSmall(const uint8_t *pGlyphs, uint8_t Start, uint8_t End, uint8_t Line);
+#endif
 void UI_DisplayFrequency(const char *string, uint8_t X, uint8_t Y, bool center);
 #endif
 
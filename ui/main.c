@@ -24,6 +24,7 @@
 #include "bitmaps.h"
 #include "board.h"
 #include "driver/bk4819.h"
+#include "driver/eeprom.h"
 #include "driver/st7565.h"
 #include "external/printf/printf.h"
 #include "functions.h"
@@ -38,6 +39,31 @@
 
 center_line_t center_line = CENTER_LINE_NONE;
 
+static cached_text_t channel_name_cache[2];   // one per VFO
+static cached_text_t dtmf_contact_cache[2];   // one per DTMF text line
+
+// ***************************************************************************
+
+static const char *GetDTMFContact(const unsigned int slot, const char *pId)
+{	// returns the contact name for the ID, or the ID itself when there's no such contact
+	cached_text_t *p   = &dtmf_contact_cache[slot];
+	uint32_t       key = 0;
+	unsigned int   i;
+
+	// DTMF_FindContact() only compares the first 3 chars
+	for (i = 0; i < 3 && pId[i] != 0; i++)
+		key |= (uint32_t)(uint8_t)pId[i] << (i * 8);
+
+	if (!UI_IsTextCached(p, key))
+	{
+		memset(p->text, 0, sizeof(p->text));
+		p->found = DTMF_FindContact(pId, p->text);
+		UI_SetTextCached(p, key);
+	}
+
+	return p->found ? p->text : pId;
+}
+
 // ***************************************************************************
 
 static void DrawSmallAntennaAndBars(uint8_t *p, unsigned int level)
@@ -222,497 +248,712 @@ void UI_UpdateRSSI(const int16_t rssi, const int vfo)
 
 // ***************************************************************************
 
-void UI_DisplayMain(void)
-{
-	const unsigned int line0 = 0;  // text screen line
-	const unsigned int line1 = 4;
+static bool DrawVfo(const unsigned int vfo_num, const unsigned int activeTxVFO)
+{	// returns false when the VFOs after this one are to be left blank
 	char               String[22];
-	unsigned int       vfo_num;
-
-	center_line = CENTER_LINE_NONE;
+	const unsigned int line       = (vfo_num == 0) ? 0 : 4;   // VFO A on lines 0-2, VFO B on lines 4-6
+	const bool         isMainVFO   = (vfo_num == gEeprom.TX_VFO);
+	uint8_t           *p_line0    = gFrameBuffer[line + 0];
+	uint8_t           *p_line1    = gFrameBuffer[line + 1];
+	unsigned int       mode       = 0;
 
-	// clear the screen
-	memset(gFrameBuffer, 0, sizeof(gFrameBuffer));
-
-	if(gLowBattery && !gLowBatteryConfirmed) {
-		UI_DisplayPopup("LOW BATTERY");
-		ST7565_BlitFullScreen();
-		return;
-	}
-
-	if (gEeprom.KEY_LOCK && gKeypadLocked > 0)
-	{	// tell user how to unlock the keyboard
-		UI_PrintString("长按解锁键", 0, LCD_WIDTH, 1, 8);
-		UI_PrintString("以解锁", 0, LCD_WIDTH, 3, 8);
-		ST7565_BlitFullScreen();
-		return;
-	}
-							
-	unsigned int activeTxVFO = gRxVfoIsActive ? gEeprom.RX_VFO : gEeprom.TX_VFO;
-
-	for (vfo_num = 0; vfo_num < 2; vfo_num++)
+	if (activeTxVFO != vfo_num) // this is not active TX VFO
 	{
-		const unsigned int line       = (vfo_num == 0) ? line0 : line1;
-		const bool         isMainVFO   = (vfo_num == gEeprom.TX_VFO);
-		uint8_t           *p_line0    = gFrameBuffer[line + 0];
-		uint8_t           *p_line1    = gFrameBuffer[line + 1];
-		unsigned int       mode       = 0;
-
-		if (activeTxVFO != vfo_num) // this is not active TX VFO
-		{
-			if (gDTMF_CallState != DTMF_CALL_STATE_NONE || gDTMF_IsTx || gDTMF_InputMode)
-			{	// show DTMF stuff
+		if (gDTMF_CallState != DTMF_CALL_STATE_NONE || gDTMF_IsTx || gDTMF_InputMode)
+		{	// show DTMF stuff
 
-				char Contact[16];
-
-				if (!gDTMF_InputMode)
-				{
-					memset(Contact, 0, sizeof(Contact));
-					if (gDTMF_CallState == DTMF_CALL_STATE_CALL_OUT)
-						strcpy(String, (gDTMF_State == DTMF_STATE_CALL_OUT_RSP) ? "拨号(回答)" : "拨号");
-					else
-					if (gDTMF_CallState == DTMF_CALL_STATE_RECEIVED || gDTMF_CallState == DTMF_CALL_STATE_RECEIVED_STAY)
-						sprintf(String, "呼叫来自:%s", (DTMF_FindContact(gDTMF_Caller, Contact)) ? Contact : gDTMF_Caller);
-					else
-					if (gDTMF_IsTx)
-						strcpy(String, (gDTMF_State == DTMF_STATE_TX_SUCC) ? "DTMF 发射(成功)" : "DTMF 发射");
-				}
+			if (!gDTMF_InputMode)
+			{
+				if (gDTMF_CallState == DTMF_CALL_STATE_CALL_OUT)
+					strcpy(String, (gDTMF_State == DTMF_STATE_CALL_OUT_RSP) ? "拨号(回答)" : "拨号");
 				else
-				{
-					sprintf(String, ">%s", gDTMF_InputBox);
-				}
-				UI_PrintString(String, 2, 0, 0 + (vfo_num * 3), 8);
-
-				memset(String,  0, sizeof(String));
-				if (!gDTMF_InputMode)
-				{
-					memset(Contact, 0, sizeof(Contact));
-					if (gDTMF_CallState == DTMF_CALL_STATE_CALL_OUT)
-						sprintf(String, ">%s", (DTMF_FindContact(gDTMF_String, Contact)) ? Contact : gDTMF_String);
-					else
-					if (gDTMF_CallState == DTMF_CALL_STATE_RECEIVED || gDTMF_CallState == DTMF_CALL_STATE_RECEIVED_STAY)
-						sprintf(String, ">%s", (DTMF_FindContact(gDTMF_Callee, Contact)) ? Contact : gDTMF_Callee);
-					else
-					if (gDTMF_IsTx)
-						sprintf(String, ">%s", gDTMF_String);
-				}
-				UI_PrintString(String, 2, 0, 2 + (vfo_num * 3), 8);
+				if (gDTMF_CallState == DTMF_CALL_STATE_RECEIVED || gDTMF_CallState == DTMF_CALL_STATE_RECEIVED_STAY)
+					sprintf(String, "呼叫来自:%s", GetDTMFContact(0, gDTMF_Caller));
+				else
+				if (gDTMF_IsTx)
+					strcpy(String, (gDTMF_State == DTMF_STATE_TX_SUCC) ? "DTMF 发射(成功)" : "DTMF 发射");
+			}
+			else
+			{
+				sprintf(String, ">%s", gDTMF_InputBox);
+			}
+			UI_PrintString(String, 2, 0, 0 + (vfo_num * 3), 8);
 
-				center_line = CENTER_LINE_IN_USE;
-				continue;
+			memset(String,  0, sizeof(String));
+			if (!gDTMF_InputMode)
+			{
+				if (gDTMF_CallState == DTMF_CALL_STATE_CALL_OUT)
+					sprintf(String, ">%s", GetDTMFContact(1, gDTMF_String));
+				else
+				if (gDTMF_CallState == DTMF_CALL_STATE_RECEIVED || gDTMF_CallState == DTMF_CALL_STATE_RECEIVED_STAY)
+					sprintf(String, ">%s", GetDTMFContact(1, gDTMF_Callee));
+				else
+				if (gDTMF_IsTx)
+					sprintf(String, ">%s", gDTMF_String);
 			}
+			UI_PrintString(String, 2, 0, 2 + (vfo_num * 3), 8);
 
-			// highlight the selected/used VFO with a marker
-			if (isMainVFO)
-				memmove(p_line0 + 0, BITMAP_VFO_Default, sizeof(BITMAP_VFO_Default));
-		}
-		else // active TX VFO
-		{	// highlight the selected/used VFO with a marker
-			if (isMainVFO)
-				memmove(p_line0 + 0, BITMAP_VFO_Default, sizeof(BITMAP_VFO_Default));
-			else
-				memmove(p_line0 + 0, BITMAP_VFO_NotDefault, sizeof(BITMAP_VFO_NotDefault));
+			center_line = CENTER_LINE_IN_USE;
+			return true;
 		}
 
-		if (gCurrentFunction == FUNCTION_TRANSMIT)
-		{	// transmitting
+		// highlight the selected/used VFO with a marker
+		if (isMainVFO)
+			memmove(p_line0 + 0, BITMAP_VFO_Default, sizeof(BITMAP_VFO_Default));
+	}
+	else // active TX VFO
+	{	// highlight the selected/used VFO with a marker
+		if (isMainVFO)
+			memmove(p_line0 + 0, BITMAP_VFO_Default, sizeof(BITMAP_VFO_Default));
+		else
+			memmove(p_line0 + 0, BITMAP_VFO_NotDefault, sizeof(BITMAP_VFO_NotDefault));
+	}
+
+	if (gCurrentFunction == FUNCTION_TRANSMIT)
+	{	// transmitting
 
 #ifdef ENABLE_ALARM
-			if (gAlarmState == ALARM_STATE_ALARM)
-				mode = 2;
-			else
+		if (gAlarmState == ALARM_STATE_ALARM)
+			mode = 2;
+		else
 #endif
-			{
-				if (activeTxVFO == vfo_num)
-				{	// show the TX symbol
-					mode = 1;
+		{
+			if (activeTxVFO == vfo_num)
+			{	// show the TX symbol
+				mode = 1;
 #ifdef ENABLE_SMALL_BOLD
-					UI_PrintStringSmallBold("TX", 14, 0, line);
+				UI_PrintStringSmallBold("TX", 14, 0, line);
 #else
-					UI_PrintStringSmall("TX", 14, 0, line);
+				UI_PrintStringSmall("TX", 14, 0, line);
 #endif
-				}
 			}
 		}
-		else
-		{	// receiving .. show the RX symbol
-			mode = 2;
-			if ((gCurrentFunction == FUNCTION_RECEIVE ||
-			     gCurrentFunction == FUNCTION_MONITOR ||
-			     gCurrentFunction == FUNCTION_INCOMING) &&
-			     gEeprom.RX_VFO == vfo_num)
-			{
+	}
+	else
+	{	// receiving .. show the RX symbol
+		mode = 2;
+		if ((gCurrentFunction == FUNCTION_RECEIVE ||
+		     gCurrentFunction == FUNCTION_MONITOR ||
+		     gCurrentFunction == FUNCTION_INCOMING) &&
+		     gEeprom.RX_VFO == vfo_num)
+		{
 #ifdef ENABLE_SMALL_BOLD
-				UI_PrintStringSmallBold("RX", 14, 0, line);
+			UI_PrintStringSmallBold("RX", 14, 0, line);
 #else
-				UI_PrintStringSmall("RX", 14, 0, line);
+			UI_PrintStringSmall("RX", 14, 0, line);
 #endif
-			}
 		}
+	}
 
-		if (IS_MR_CHANNEL(gEeprom.ScreenChannel[vfo_num]))
-		{	// channel mode
-			const unsigned int x = 2;
-			const bool inputting = (gInputBoxIndex == 0 || gEeprom.TX_VFO != vfo_num) ? false : true;
-			if (!inputting)
-				sprintf(String, "M%u", gEeprom.ScreenChannel[vfo_num] + 1);
-			else
-				sprintf(String, "M%.3s", INPUTBOX_GetAscii());  // show the input text
-			UI_PrintStringSmall(String, x, 0, line + 1);
-		}
-		else if (IS_FREQ_CHANNEL(gEeprom.ScreenChannel[vfo_num]))
-		{	// frequency mode
-			// show the frequency band number
-			const unsigned int x = 2;
-			char * buf = gEeprom.VfoInfo[vfo_num].pRX->Frequency < 100000000 ? "" : "+";
-			sprintf(String, "F%u%s", 1 + gEeprom.ScreenChannel[vfo_num] - FREQ_CHANNEL_FIRST, buf);
-			UI_PrintStringSmall(String, x, 0, line + 1);
-		}
+	if (IS_MR_CHANNEL(gEeprom.ScreenChannel[vfo_num]))
+	{	// channel mode
+		const unsigned int x = 2;
+		const bool inputting = (gInputBoxIndex == 0 || gEeprom.TX_VFO != vfo_num) ? false : true;
+		if (!inputting)
+			sprintf(String, "M%u", gEeprom.ScreenChannel[vfo_num] + 1);
+		else
+			sprintf(String, "M%.3s", INPUTBOX_GetAscii());  // show the input text
+		UI_PrintStringSmall(String, x, 0, line + 1);
+	}
+	else if (IS_FREQ_CHANNEL(gEeprom.ScreenChannel[vfo_num]))
+	{	// frequency mode
+		// show the frequency band number
+		const unsigned int x = 2;
+		char * buf = gEeprom.VfoInfo[vfo_num].pRX->Frequency < 100000000 ? "" : "+";
+		sprintf(String, "F%u%s", 1 + gEeprom.ScreenChannel[vfo_num] - FREQ_CHANNEL_FIRST, buf);
+		UI_PrintStringSmall(String, x, 0, line + 1);
+	}
 #ifdef ENABLE_NOAA
+	else
+	{
+		if (gInputBoxIndex == 0 || gEeprom.TX_VFO != vfo_num)
+		{	// channel number
+			sprintf(String, "N%u", 1 + gEeprom.ScreenChannel[vfo_num] - NOAA_CHANNEL_FIRST);
+		}
 		else
-		{
-			if (gInputBoxIndex == 0 || gEeprom.TX_VFO != vfo_num)
-			{	// channel number
-				sprintf(String, "N%u", 1 + gEeprom.ScreenChannel[vfo_num] - NOAA_CHANNEL_FIRST);
-			}
-			else
-			{	// user entering channel number
-				sprintf(String, "N%u%u", '0' + gInputBox[0], '0' + gInputBox[1]);
-			}
-			UI_PrintStringSmall(String, 7, 0, line + 1);
+		{	// user entering channel number
+			sprintf(String, "N%u%u", '0' + gInputBox[0], '0' + gInputBox[1]);
 		}
+		UI_PrintStringSmall(String, 7, 0, line + 1);
+	}
 #endif
 
-		// ************
+	// ************
 
-		unsigned int state = VfoState[vfo_num];
+	unsigned int state = VfoState[vfo_num];
 
 #ifdef ENABLE_ALARM
-		if (gCurrentFunction == FUNCTION_TRANSMIT && gAlarmState == ALARM_STATE_ALARM) {
-			if (activeTxVFO == vfo_num)
-				state = VFO_STATE_ALARM;
-		}
+	if (gCurrentFunction == FUNCTION_TRANSMIT && gAlarmState == ALARM_STATE_ALARM) {
+		if (activeTxVFO == vfo_num)
+			state = VFO_STATE_ALARM;
+	}
 #endif
 
-		uint32_t frequency = gEeprom.VfoInfo[vfo_num].pRX->Frequency;
+	uint32_t frequency = gEeprom.VfoInfo[vfo_num].pRX->Frequency;
 
-		if (state != VFO_STATE_NORMAL)
-		{
-			const char *state_list[] = {"", "占线", "电量低", "禁止发射", "超时", "警报", "电压太高"};
-			if (state < ARRAY_SIZE(state_list))
-				UI_PrintString(state_list[state], 31, 0, line, 8);
-		}
-		else if (gInputBoxIndex > 0 && IS_FREQ_CHANNEL(gEeprom.ScreenChannel[vfo_num]) && gEeprom.TX_VFO == vfo_num)
-		{	// user entering a frequency
-			const char * ascii = INPUTBOX_GetAscii();
-			bool isGigaF = frequency>=100000000;
-			sprintf(String, "%.*s.%.3s", 3 + isGigaF, ascii, ascii + 3 + isGigaF);
+	if (state != VFO_STATE_NORMAL)
+	{
+		const char *state_list[] = {"", "占线", "电量低", "禁止发射", "超时", "警报", "电压太高"};
+		if (state < ARRAY_SIZE(state_list))
+			UI_PrintString(state_list[state], 31, 0, line, 8);
+	}
+	else if (gInputBoxIndex > 0 && IS_FREQ_CHANNEL(gEeprom.ScreenChannel[vfo_num]) && gEeprom.TX_VFO == vfo_num)
+	{	// user entering a frequency
+		const char * ascii = INPUTBOX_GetAscii();
+		bool isGigaF = frequency>=100000000;
+		sprintf(String, "%.*s.%.3s", 3 + isGigaF, ascii, ascii + 3 + isGigaF);
 #ifdef ENABLE_BIG_FREQ
-			if(!isGigaF) {
-				// show the remaining 2 small frequency digits
-				UI_PrintStringSmall(String + 7, 113, 0, line + 1);
-				String[7] = 0;
-				// show the main large frequency digits
-				UI_DisplayFrequency(String, 32, line, false);
-			}
-			else
-#endif
-			{
-				// show the frequency in the main font
-				UI_PrintString(String, 32, 0, line, 8);
-			}
-
-			break;
+		if(!isGigaF) {
+			// show the remaining 2 small frequency digits
+			UI_PrintStringSmall(String + 7, 113, 0, line + 1);
+			String[7] = 0;
+			// show the main large frequency digits
+			UI_DisplayFrequency(String, 32, line, false);
 		}
 		else
+#endif
 		{
-			if (gCurrentFunction == FUNCTION_TRANSMIT)
-			{	// transmitting
-				if (activeTxVFO == vfo_num)
-					frequency = gEeprom.VfoInfo[vfo_num].pTX->Frequency;
-			}
+			// show the frequency in the main font
+			UI_PrintString(String, 32, 0, line, 8);
+		}
 
-			if (IS_MR_CHANNEL(gEeprom.ScreenChannel[vfo_num]))
-			{	// it's a channel
+		return false;
+	}
+	else
+	{
+		if (gCurrentFunction == FUNCTION_TRANSMIT)
+		{	// transmitting
+			if (activeTxVFO == vfo_num)
+				frequency = gEeprom.VfoInfo[vfo_num].pTX->Frequency;
+		}
 
-				// show the scan list assigment symbols
-				const uint8_t attributes = gMR_ChannelAttributes[gEeprom.ScreenChannel[vfo_num]];
-				if (attributes & MR_CH_SCANLIST1)
-					memmove(p_line0 + 113, BITMAP_ScanList1, sizeof(BITMAP_ScanList1));
-				if (attributes & MR_CH_SCANLIST2)
-					memmove(p_line0 + 120, BITMAP_ScanList2, sizeof(BITMAP_ScanList2));
+		if (IS_MR_CHANNEL(gEeprom.ScreenChannel[vfo_num]))
+		{	// it's a channel
 
-				// compander symbol
+			// show the scan list assigment symbols
+			const uint8_t attributes = gMR_ChannelAttributes[gEeprom.ScreenChannel[vfo_num]];
+			if (attributes & MR_CH_SCANLIST1)
+				memmove(p_line0 + 113, BITMAP_ScanList1, sizeof(BITMAP_ScanList1));
+			if (attributes & MR_CH_SCANLIST2)
+				memmove(p_line0 + 120, BITMAP_ScanList2, sizeof(BITMAP_ScanList2));
+
+			// compander symbol
 #ifndef ENABLE_BIG_FREQ
-				if ((attributes & MR_CH_COMPAND) > 0)
-					memmove(p_line0 + 120 + LCD_WIDTH, BITMAP_compand, sizeof(BITMAP_compand));
+			if ((attributes & MR_CH_COMPAND) > 0)
+				memmove(p_line0 + 120 + LCD_WIDTH, BITMAP_compand, sizeof(BITMAP_compand));
 #else
-				// TODO:  // find somewhere else to put the symbol
+			// TODO:  // find somewhere else to put the symbol
 #endif
 
-				switch (gEeprom.CHANNEL_DISPLAY_MODE)
-				{
-					case MDF_FREQUENCY:	// show the channel frequency
-						sprintf(String, "%3u.%05u", frequency / 100000, frequency % 100000);
+			switch (gEeprom.CHANNEL_DISPLAY_MODE)
+			{
+				case MDF_FREQUENCY:	// show the channel frequency
+					sprintf(String, "%3u.%05u", frequency / 100000, frequency % 100000);
 #ifdef ENABLE_BIG_FREQ
-						if(frequency < 100000000) {
-							// show the remaining 2 small frequency digits
-							UI_PrintStringSmall(String + 7, 113, 0, line + 1);
-							String[7] = 0;
-							// show the main large frequency digits
-							UI_DisplayFrequency(String, 32, line, false);
-						}
-						else
+					if(frequency < 100000000) {
+						// show the remaining 2 small frequency digits
+						UI_PrintStringSmall(String + 7, 113, 0, line + 1);
+						String[7] = 0;
+						// show the main large frequency digits
+						UI_DisplayFrequency(String, 32, line, false);
+					}
+					else
 #endif
-						{
-							// show the frequency in the main font
-							UI_PrintString(String, 32, 0, line, 8);
-						}
+					{
+						// show the frequency in the main font
+						UI_PrintString(String, 32, 0, line, 8);
+					}
 
-						break;
+					break;
 
-					case MDF_CHANNEL:	// show the channel number
-						sprintf(String, "CH-%03u", gEeprom.ScreenChannel[vfo_num] + 1);
-						UI_PrintString(String, 32, 0, line, 8);
-						break;
+				case MDF_CHANNEL:	// show the channel number
+					sprintf(String, "CH-%03u", gEeprom.ScreenChannel[vfo_num] + 1);
+					UI_PrintString(String, 32, 0, line, 8);
+					break;
 
-					case MDF_NAME:		// show the channel name
-					case MDF_NAME_FREQ:	// show the channel name and frequency
+				case MDF_NAME:		// show the channel name
+				case MDF_NAME_FREQ:	// show the channel name and frequency
 
-						BOARD_fetchChannelName(String, gEeprom.ScreenChannel[vfo_num]);
-						if (String[0] == 0)
-						{	// no channel name, show the channel number instead
-							sprintf(String, "CH-%03u", gEeprom.ScreenChannel[vfo_num] + 1);
-						}
+					strcpy(String, UI_GetCachedChannelName(&channel_name_cache[vfo_num], gEeprom.ScreenChannel[vfo_num]));
+					if (String[0] == 0)
+					{	// no channel name, show the channel number instead
+						sprintf(String, "CH-%03u", gEeprom.ScreenChannel[vfo_num] + 1);
+					}
 
-						if (gEeprom.CHANNEL_DISPLAY_MODE == MDF_NAME) {
-							UI_PrintString(String, 32, 0, line, 8);
-						}
-						else {
+					if (gEeprom.CHANNEL_DISPLAY_MODE == MDF_NAME) {
+						UI_PrintString(String, 32, 0, line, 8);
+					}
+					else {
 #ifdef ENABLE_SMALL_BOLD
-							UI_PrintStringSmallBold(String, 32 + 4, 0, line);
+						UI_PrintStringSmallBold(String, 32 + 4, 0, line);
 #else
-							UI_PrintStringSmall(String, 32 + 4, 0, line);
+						UI_PrintStringSmall(String, 32 + 4, 0, line);
 #endif
-							// show the channel frequency below the channel number/name
-							sprintf(String, "%03u.%05u", frequency / 100000, frequency % 100000);
-							UI_PrintStringSmall(String, 32 + 4, 0, line + 1);
-						}
+						// show the channel frequency below the channel number/name
+						sprintf(String, "%03u.%05u", frequency / 100000, frequency % 100000);
+						UI_PrintStringSmall(String, 32 + 4, 0, line + 1);
+					}
 
-						break;
-				}
+					break;
 			}
-			else
-			{	// frequency mode
-				sprintf(String, "%3u.%05u", frequency / 100000, frequency % 100000);
+		}
+		else
+		{	// frequency mode
+			sprintf(String, "%3u.%05u", frequency / 100000, frequency % 100000);
 
 #ifdef ENABLE_BIG_FREQ
-				if(frequency < 100000000) {
-					// show the remaining 2 small frequency digits
-					UI_PrintStringSmall(String + 7, 113, 0, line + 1);
-					String[7] = 0;
-					// show the main large frequency digits
-					UI_DisplayFrequency(String, 32, line, false);
-				}
-				else
+			if(frequency < 100000000) {
+				// show the remaining 2 small frequency digits
+				UI_PrintStringSmall(String + 7, 113, 0, line + 1);
+				String[7] = 0;
+				// show the main large frequency digits
+				UI_DisplayFrequency(String, 32, line, false);
+			}
+			else
 #endif
-				{
-					// show the frequency in the main font
-					UI_PrintString(String, 32, 0, line, 8);
-				}
+			{
+				// show the frequency in the main font
+				UI_PrintString(String, 32, 0, line, 8);
+			}
 
-				// show the channel symbols
-				const uint8_t attributes = gMR_ChannelAttributes[gEeprom.ScreenChannel[vfo_num]];
-				if ((attributes & MR_CH_COMPAND) > 0)
+			// show the channel symbols
+			const uint8_t attributes = gMR_ChannelAttributes[gEeprom.ScreenChannel[vfo_num]];
+			if ((attributes & MR_CH_COMPAND) > 0)
 #ifdef ENABLE_BIG_FREQ
-					memmove(p_line0 + 120, BITMAP_compand, sizeof(BITMAP_compand));
+				memmove(p_line0 + 120, BITMAP_compand, sizeof(BITMAP_compand));
 #else
-					memmove(p_line0 + 120 + LCD_WIDTH, BITMAP_compand, sizeof(BITMAP_compand));
+				memmove(p_line0 + 120 + LCD_WIDTH, BITMAP_compand, sizeof(BITMAP_compand));
 #endif
-			}
 		}
+	}
 
-		// ************
+	// ************
 
-		{	// show the TX/RX level
-			uint8_t Level = 0;
+	{	// show the TX/RX level
+		uint8_t Level = 0;
 
-			if (mode == 1)
-			{	// TX power level
-				switch (gRxVfo->OUTPUT_POWER)
-				{
-					case OUTPUT_POWER_LOW:  Level = 2; break;
-					case OUTPUT_POWER_MID:  Level = 4; break;
-					case OUTPUT_POWER_HIGH: Level = 6; break;
-				}
-			}
-			else
-			if (mode == 2)
-			{	// RX signal level
-				#ifndef ENABLE_RSSI_BAR
-					// bar graph
-					if (gVFO_RSSI_bar_level[vfo_num] > 0)
-						Level = gVFO_RSSI_bar_level[vfo_num];
-				#endif
+		if (mode == 1)
+		{	// TX power level
+			switch (gRxVfo->OUTPUT_POWER)
+			{
+				case OUTPUT_POWER_LOW:  Level = 2; break;
+				case OUTPUT_POWER_MID:  Level = 4; break;
+				case OUTPUT_POWER_HIGH: Level = 6; break;
 			}
-			if(Level)
-				DrawSmallAntennaAndBars(p_line1 + LCD_WIDTH, Level);
 		}
+		else
+		if (mode == 2)
+		{	// RX signal level
+			#ifndef ENABLE_RSSI_BAR
+				// bar graph
+				if (gVFO_RSSI_bar_level[vfo_num] > 0)
+					Level = gVFO_RSSI_bar_level[vfo_num];
+			#endif
+		}
+		if(Level)
+			DrawSmallAntennaAndBars(p_line1 + LCD_WIDTH, Level);
+	}
 
-		// ************
+	// ************
 
-		String[0] = '\0';
+	String[0] = '\0';
 
-		// show the modulation symbol
-		const char * s = "";
-		const ModulationMode_t mod = gEeprom.VfoInfo[vfo_num].Modulation;
-		switch (mod){
-			case MODULATION_FM: {
-				const FREQ_Config_t *pConfig = (mode == 1) ? gEeprom.VfoInfo[vfo_num].pTX : gEeprom.VfoInfo[vfo_num].pRX;
-				const unsigned int code_type = pConfig->CodeType;
-				const char *code_list[] = {"", "CT", "DCS", "DCR"};
-				if (code_type < ARRAY_SIZE(code_list))
-					s = code_list[code_type];
-				break;
-			}
-			default:
-				s = gModulationStr[mod];
+	// show the modulation symbol
+	const char * s = "";
+	const ModulationMode_t mod = gEeprom.VfoInfo[vfo_num].Modulation;
+	switch (mod){
+		case MODULATION_FM: {
+			const FREQ_Config_t *pConfig = (mode == 1) ? gEeprom.VfoInfo[vfo_num].pTX : gEeprom.VfoInfo[vfo_num].pRX;
+			const unsigned int code_type = pConfig->CodeType;
+			const char *code_list[] = {"", "CT", "DCS", "DCR"};
+			if (code_type < ARRAY_SIZE(code_list))
+				s = code_list[code_type];
 			break;
-		}		
-		UI_PrintStringSmall(s, LCD_WIDTH + 24, 0, line + 1);
-
-		if (state == VFO_STATE_NORMAL || state == VFO_STATE_ALARM)
-		{	// show the TX power
-			const char pwr_list[] = "LMH";
-			const unsigned int i = gEeprom.VfoInfo[vfo_num].OUTPUT_POWER;
-			String[0] = (i < ARRAY_SIZE(pwr_list)) ? pwr_list[i] : '\0';
-			String[1] = '\0';
-			UI_PrintStringSmall(String, LCD_WIDTH + 46, 0, line + 1);
 		}
+		default:
+			s = gModulationStr[mod];
+		break;
+	}		
+	UI_PrintStringSmall(s, LCD_WIDTH + 24, 0, line + 1);
+
+	if (state == VFO_STATE_NORMAL || state == VFO_STATE_ALARM)
+	{	// show the TX power
+		const char pwr_list[] = "LMH";
+		const unsigned int i = gEeprom.VfoInfo[vfo_num].OUTPUT_POWER;
+		String[0] = (i < ARRAY_SIZE(pwr_list)) ? pwr_list[i] : '\0';
+		String[1] = '\0';
+		UI_PrintStringSmall(String, LCD_WIDTH + 46, 0, line + 1);
+	}
 
-		if (gEeprom.VfoInfo[vfo_num].freq_config_RX.Frequency != gEeprom.VfoInfo[vfo_num].freq_config_TX.Frequency)
-		{	// show the TX offset symbol
-			const char dir_list[] = "\0+-";
-			const unsigned int i = gEeprom.VfoInfo[vfo_num].TX_OFFSET_FREQUENCY_DIRECTION;
-			String[0] = (i < sizeof(dir_list)) ? dir_list[i] : '?';
-			String[1] = '\0';
-			UI_PrintStringSmall(String, LCD_WIDTH + 54, 0, line + 1);
-		}
+	if (gEeprom.VfoInfo[vfo_num].freq_config_RX.Frequency != gEeprom.VfoInfo[vfo_num].freq_config_TX.Frequency)
+	{	// show the TX offset symbol
+		const char dir_list[] = "\0+-";
+		const unsigned int i = gEeprom.VfoInfo[vfo_num].TX_OFFSET_FREQUENCY_DIRECTION;
+		String[0] = (i < sizeof(dir_list)) ? dir_list[i] : '?';
+		String[1] = '\0';
+		UI_PrintStringSmall(String, LCD_WIDTH + 54, 0, line + 1);
+	}
 
-		// show the TX/RX reverse symbol
-		if (gEeprom.VfoInfo[vfo_num].FrequencyReverse)
-			UI_PrintStringSmall("R", LCD_WIDTH + 62, 0, line + 1);
+	// show the TX/RX reverse symbol
+	if (gEeprom.VfoInfo[vfo_num].FrequencyReverse)
+		UI_PrintStringSmall("R", LCD_WIDTH + 62, 0, line + 1);
 
-		{	// show the narrow band symbol
-			String[0] = '\0';
-			if (gEeprom.VfoInfo[vfo_num].CHANNEL_BANDWIDTH == BANDWIDTH_NARROW)
-			{
-				String[0] = 'N';
-				String[1] = '\0';
-			}
-			UI_PrintStringSmall(String, LCD_WIDTH + 70, 0, line + 1);
+	{	// show the narrow band symbol
+		String[0] = '\0';
+		if (gEeprom.VfoInfo[vfo_num].CHANNEL_BANDWIDTH == BANDWIDTH_NARROW)
+		{
+			String[0] = 'N';
+			String[1] = '\0';
 		}
+		UI_PrintStringSmall(String, LCD_WIDTH + 70, 0, line + 1);
+	}
 
-		// show the DTMF decoding symbol
-		if (gEeprom.VfoInfo[vfo_num].DTMF_DECODING_ENABLE || gSetting_KILLED)
-			UI_PrintStringSmall("DTMF", LCD_WIDTH + 78, 0, line + 1);
+	// show the DTMF decoding symbol
+	if (gEeprom.VfoInfo[vfo_num].DTMF_DECODING_ENABLE || gSetting_KILLED)
+		UI_PrintStringSmall("DTMF", LCD_WIDTH + 78, 0, line + 1);
 
-		// show the audio scramble symbol
-		if (gEeprom.VfoInfo[vfo_num].SCRAMBLING_TYPE > 0 && gSetting_ScrambleEnable)
-			UI_PrintStringSmall("SCR", LCD_WIDTH + 106, 0, line + 1);
-	}
+	// show the audio scramble symbol
+	if (gEeprom.VfoInfo[vfo_num].SCRAMBLING_TYPE > 0 && gSetting_ScrambleEnable)
+		UI_PrintStringSmall("SCR", LCD_WIDTH + 106, 0, line + 1);
+
+	return true;
+}
 
-	if (center_line == CENTER_LINE_NONE)
-	{	// we're free to use the middle line
+static bool DrawCenterLine(void)
+{	// the middle line (3), free when the VFOs aren't using it, returns false when there's nothing to blit
+	char String[22];
 
-		const bool rx = (gCurrentFunction == FUNCTION_RECEIVE ||
-		                 gCurrentFunction == FUNCTION_MONITOR ||
-		                 gCurrentFunction == FUNCTION_INCOMING);
+	const bool rx = (gCurrentFunction == FUNCTION_RECEIVE ||
+	                 gCurrentFunction == FUNCTION_MONITOR ||
+	                 gCurrentFunction == FUNCTION_INCOMING);
 
 #ifdef ENABLE_AUDIO_BAR
-		if (gSetting_mic_bar && gCurrentFunction == FUNCTION_TRANSMIT) {
-			center_line = CENTER_LINE_AUDIO_BAR;
-			UI_DisplayAudioBar();
-		}
-		else
+	if (gSetting_mic_bar && gCurrentFunction == FUNCTION_TRANSMIT) {
+		center_line = CENTER_LINE_AUDIO_BAR;
+		UI_DisplayAudioBar();
+	}
+	else
 #endif
 
 #if defined(ENABLE_AM_FIX) && defined(ENABLE_AM_FIX_SHOW_DATA)
-		if (rx && gEeprom.VfoInfo[gEeprom.RX_VFO].Modulation == MODULATION_AM && gSetting_AM_fix)
-		{
-			if (gScreenToDisplay != DISPLAY_MAIN ||
-				gDTMF_CallState != DTMF_CALL_STATE_NONE)
-				return;
+	if (rx && gEeprom.VfoInfo[gEeprom.RX_VFO].Modulation == MODULATION_AM && gSetting_AM_fix)
+	{
+		if (gScreenToDisplay != DISPLAY_MAIN ||
+			gDTMF_CallState != DTMF_CALL_STATE_NONE)
+			return false;
 
-			center_line = CENTER_LINE_AM_FIX_DATA;
-			AM_fix_print_data(gEeprom.RX_VFO, String);
-			UI_PrintStringSmall(String, 2, 0, 3);
-		}
-		else
+		center_line = CENTER_LINE_AM_FIX_DATA;
+		AM_fix_print_data(gEeprom.RX_VFO, String);
+		UI_PrintStringSmall(String, 2, 0, 3);
+	}
+	else
 #endif
 
 #ifdef ENABLE_RSSI_BAR
-		if (rx) {
-			center_line = CENTER_LINE_RSSI;
-			DisplayRSSIBar(gCurrentRSSI[gEeprom.RX_VFO], false);
-		}
-		else
+	if (rx) {
+		center_line = CENTER_LINE_RSSI;
+		DisplayRSSIBar(gCurrentRSSI[gEeprom.RX_VFO], false);
+	}
+	else
 #endif
-		if (rx || gCurrentFunction == FUNCTION_FOREGROUND || gCurrentFunction == FUNCTION_POWER_SAVE)
-		{
-			#if 1
-				if (gSetting_live_DTMF_decoder && gDTMF_RX_live[0] != 0)
-				{	// show live DTMF decode
-					const unsigned int len = strlen(gDTMF_RX_live);
-					const unsigned int idx = (len > (17 - 5)) ? len - (17 - 5) : 0;  // limit to last 'n' chars
-
-					if (gScreenToDisplay != DISPLAY_MAIN ||
-						gDTMF_CallState != DTMF_CALL_STATE_NONE)
-						return;
-						
-					center_line = CENTER_LINE_DTMF_DEC;
-					
-					strcpy(String, "DTMF ");
-					strcat(String, gDTMF_RX_live + idx);
-					UI_PrintStringSmall(String, 2, 0, 3);
-				}
-			#else
-				if (gSetting_live_DTMF_decoder && gDTMF_RX_index > 0)
-				{	// show live DTMF decode
-					const unsigned int len = gDTMF_RX_index;
-					const unsigned int idx = (len > (17 - 5)) ? len - (17 - 5) : 0;  // limit to last 'n' chars
-
-					if (gScreenToDisplay != DISPLAY_MAIN ||
-						gDTMF_CallState != DTMF_CALL_STATE_NONE)
-						return;
-
-					center_line = CENTER_LINE_DTMF_DEC;
-					
-					strcpy(String, "DTMF ");
-					strcat(String, gDTMF_RX + idx);
-					UI_PrintStringSmall(String, 2, 0, 3);
-				}
-			#endif
+	if (rx || gCurrentFunction == FUNCTION_FOREGROUND || gCurrentFunction == FUNCTION_POWER_SAVE)
+	{
+		#if 1
+			if (gSetting_live_DTMF_decoder && gDTMF_RX_live[0] != 0)
+			{	// show live DTMF decode
+				const unsigned int len = strlen(gDTMF_RX_live);
+				const unsigned int idx = (len > (17 - 5)) ? len - (17 - 5) : 0;  // limit to last 'n' chars
 
-#ifdef ENABLE_SHOW_CHARGE_LEVEL
-			else if (gChargingWithTypeC)
-			{	// charging .. show the battery state
 				if (gScreenToDisplay != DISPLAY_MAIN ||
 					gDTMF_CallState != DTMF_CALL_STATE_NONE)
-					return;
-						
-				center_line = CENTER_LINE_CHARGE_DATA;
+					return false;
 					
-				sprintf(String, "Charge %u.%02uV %u%%",
-					gBatteryVoltageAverage / 100, gBatteryVoltageAverage % 100,
-					BATTERY_VoltsToPercent(gBatteryVoltageAverage));
+				center_line = CENTER_LINE_DTMF_DEC;
+				
+				strcpy(String, "DTMF ");
+				strcat(String, gDTMF_RX_live + idx);
 				UI_PrintStringSmall(String, 2, 0, 3);
 			}
+		#else
+			if (gSetting_live_DTMF_decoder && gDTMF_RX_index > 0)
+			{	// show live DTMF decode
+				const unsigned int len = gDTMF_RX_index;
+				const unsigned int idx = (len > (17 - 5)) ? len - (17 - 5) : 0;  // limit to last 'n' chars
+
+				if (gScreenToDisplay != DISPLAY_MAIN ||
+					gDTMF_CallState != DTMF_CALL_STATE_NONE)
+					return false;
+
+				center_line = CENTER_LINE_DTMF_DEC;
+				
+				strcpy(String, "DTMF ");
+				strcat(String, gDTMF_RX + idx);
+				UI_PrintStringSmall(String, 2, 0, 3);
+			}
+		#endif
+
+#ifdef ENABLE_SHOW_CHARGE_LEVEL
+		else if (gChargingWithTypeC)
+		{	// charging .. show the battery state
+			if (gScreenToDisplay != DISPLAY_MAIN ||
+				gDTMF_CallState != DTMF_CALL_STATE_NONE)
+				return false;
+					
+			center_line = CENTER_LINE_CHARGE_DATA;
+				
+			sprintf(String, "Charge %u.%02uV %u%%",
+				gBatteryVoltageAverage / 100, gBatteryVoltageAverage % 100,
+				BATTERY_VoltsToPercent(gBatteryVoltageAverage));
+			UI_PrintStringSmall(String, 2, 0, 3);
+		}
 #endif
+	}
+
+	return true;
+}
+
+#ifdef ENABLE_MAIN_WIDGETS
+
+// a region of the main screen that's only redrawn when what it's drawn from changes
+typedef struct
+{
+	bool     valid;
+	bool     result;       // what the draw function returned
+	uint8_t  first_line;
+	uint8_t  lines;
+	uint32_t inputs;       // hash of everything the region was drawn from
+	uint32_t pixels;       // hash of what it left in gFrameBuffer, catches anything else drawing over it
+} widget_t;
+
+enum {
+	WIDGET_VFO_A = 0,
+	WIDGET_VFO_B,
+	WIDGET_CENTER_LINE
+};
+
+static widget_t widgets[] =
+{
+	[WIDGET_VFO_A]       = {.first_line = 0, .lines = 3},
+	[WIDGET_VFO_B]       = {.first_line = 4, .lines = 3},
+	[WIDGET_CENTER_LINE] = {.first_line = 3, .lines = 1}
+};
+
+static center_line_t widget_center_line;
+
+#define HASH_START     0u
+
+static uint32_t HashValue(const uint32_t hash, const uint32_t value)
+{	// FxHash, a rotate and one multiply per word
+	return (((hash << 5) | (hash >> 27)) ^ value) * 0x9E3779B9u;
+}
+
+static uint32_t HashWords(uint32_t hash, const uint32_t *p, unsigned int words)
+{
+	while (words-- > 0)
+		hash = HashValue(hash, *p++);
+
+	return hash;
+}
+
+static uint32_t HashText(uint32_t hash, const char *p, unsigned int size)
+{
+	while (size-- > 0 && *p != 0)
+		hash = HashValue(hash, (uint8_t)*p++);
+
+	return hash;
+}
+
+static uint32_t WidgetPixels(const widget_t *p)
+{	// only has to notice something else drew here, so a rotate and add per word (gFrameBuffer is word aligned)
+	const uint32_t *pWords = (const uint32_t *)gFrameBuffer[p->first_line];
+	unsigned int    words  = (p->lines * LCD_WIDTH) / 4;
+	uint32_t        hash   = HASH_START;
+
+	while (words-- > 0)
+		hash = ((hash << 7) | (hash >> 25)) + *pWords++;
+
+	return hash;
+}
+
+static bool WidgetIsCurrent(const widget_t *p, const uint32_t inputs)
+{
+	return p->valid && p->inputs == inputs && p->pixels == WidgetPixels(p);
+}
+
+static void WidgetClear(widget_t *p)
+{
+	memset(gFrameBuffer[p->first_line], 0, p->lines * LCD_WIDTH);
+	p->valid = false;
+}
+
+static void WidgetDrawn(widget_t *p, const uint32_t inputs)
+{
+	p->valid  = true;
+	p->inputs = inputs;
+	p->pixels = WidgetPixels(p);
+}
+
+static uint32_t VfoInputs(const unsigned int vfo_num, const unsigned int activeTxVFO)
+{	// everything DrawVfo() reads, the DTMF text isn't here as it never goes through the widgets
+	const VFO_Info_t *pInfo   = &gEeprom.VfoInfo[vfo_num];
+	const uint8_t     channel = gEeprom.ScreenChannel[vfo_num];
+	uint32_t          hash    = HASH_START;
+
+	// VFO_Info_t holds pointers, so it's a whole number of words
+	hash = HashWords(hash, (const uint32_t *)pInfo, sizeof(*pInfo) / 4);
+
+	hash = HashValue(hash, activeTxVFO);
+	hash = HashValue(hash, gEeprom.TX_VFO);
+	hash = HashValue(hash, gEeprom.RX_VFO);
+	hash = HashValue(hash, gEeprom.CHANNEL_DISPLAY_MODE);
+	hash = HashValue(hash, gCurrentFunction);
+#ifdef ENABLE_ALARM
+	hash = HashValue(hash, gAlarmState);
+#endif
+	hash = HashValue(hash, VfoState[vfo_num]);
+	hash = HashValue(hash, gRxVfo->OUTPUT_POWER);
+	hash = HashValue(hash, gVFO_RSSI_bar_level[vfo_num]);
+	hash = HashValue(hash, gSetting_KILLED);
+	hash = HashValue(hash, gSetting_ScrambleEnable);
+	hash = HashValue(hash, gEepromWriteCount);   // the channel name
+
+	if (channel < ARRAY_SIZE(gMR_ChannelAttributes))
+		hash = HashValue(hash, gMR_ChannelAttributes[channel]);
+
+	hash = HashValue(hash, gInputBoxIndex);
+	if (gInputBoxIndex > 0)
+	{
+		unsigned int i;
+		for (i = 0; i < ARRAY_SIZE(gInputBox); i++)
+			hash = HashValue(hash, gInputBox[i]);
+	}
+
+	return hash;
+}
+
+static bool CenterLineInputs(uint32_t *pHash)
+{	// everything DrawCenterLine() reads, returns false when the line follows something that's not in RAM
+	const bool rx = (gCurrentFunction == FUNCTION_RECEIVE ||
+	                 gCurrentFunction == FUNCTION_MONITOR ||
+	                 gCurrentFunction == FUNCTION_INCOMING);
+	uint32_t   hash = HASH_START;
+
+#ifdef ENABLE_AUDIO_BAR
+	if (gSetting_mic_bar && gCurrentFunction == FUNCTION_TRANSMIT)
+		return false;   // the mic level comes straight from the BK4819
+#endif
+
+#if defined(ENABLE_AM_FIX) && defined(ENABLE_AM_FIX_SHOW_DATA)
+	if (rx && gEeprom.VfoInfo[gEeprom.RX_VFO].Modulation == MODULATION_AM && gSetting_AM_fix)
+		return false;   // the AM fix keeps its own state
+#endif
+
+	hash = HashValue(hash, rx);
+	hash = HashValue(hash, gCurrentFunction);
+	hash = HashValue(hash, gScreenToDisplay);
+	hash = HashValue(hash, gDTMF_CallState);
+	hash = HashValue(hash, gEeprom.KEY_LOCK);
+	hash = HashValue(hash, gKeypadLocked);
+	hash = HashValue(hash, gEeprom.RX_VFO);
+	hash = HashValue(hash, (uint16_t)gCurrentRSSI[gEeprom.RX_VFO]);
+	hash = HashValue(hash, gSetting_live_DTMF_decoder);
+	hash = HashText(hash, gDTMF_RX_live, sizeof(gDTMF_RX_live));
+	hash = HashValue(hash, gChargingWithTypeC);
+	hash = HashValue(hash, gBatteryVoltageAverage);
+	hash = HashValue(hash, gEepromWriteCount);   // the battery calibration
+
+	*pHash = hash;
+	return true;
+}
+
+static void DisplayMainWidgets(const unsigned int activeTxVFO)
+{	// redraw only the regions whose inputs changed, or that something else drew over since
+	bool     more = true;
+	uint32_t inputs;
+	int      i;
+
+	for (i = WIDGET_VFO_A; i <= WIDGET_VFO_B; i++)
+	{
+		widget_t *p = &widgets[i];
+
+		inputs = more ? VfoInputs(i, activeTxVFO) : 0;   // 0 is blank, below a frequency being typed in
+		if (!WidgetIsCurrent(p, inputs))
+		{
+			WidgetClear(p);
+			p->result = more ? DrawVfo(i, activeTxVFO) : false;
+			WidgetDrawn(p, inputs);
 		}
+
+		more = p->result;
+	}
+
+	{
+		widget_t  *p       = &widgets[WIDGET_CENTER_LINE];
+		const bool hashed  = CenterLineInputs(&inputs);
+
+		if (!hashed || !WidgetIsCurrent(p, inputs))
+		{
+			WidgetClear(p);
+			p->result          = DrawCenterLine();
+			widget_center_line = center_line;
+			if (hashed)
+				WidgetDrawn(p, inputs);
+		}
+
+		center_line = widget_center_line;
+
+		if (!p->result)
+			return;
 	}
 
 	ST7565_BlitFullScreen();
 }
 
+#endif
+
+void UI_DisplayMain(void)
+{
+	const unsigned int activeTxVFO = gRxVfoIsActive ? gEeprom.RX_VFO : gEeprom.TX_VFO;
+	unsigned int       vfo_num;
+
+	center_line = CENTER_LINE_NONE;
+
+#ifdef ENABLE_MAIN_WIDGETS
+	// the popups and the DTMF text don't keep to the regions, they're drawn the old way
+	if (!(gLowBattery && !gLowBatteryConfirmed) &&
+	    !(gEeprom.KEY_LOCK && gKeypadLocked > 0) &&
+	    gDTMF_CallState == DTMF_CALL_STATE_NONE && !gDTMF_IsTx && !gDTMF_InputMode)
+	{
+		DisplayMainWidgets(activeTxVFO);
+		return;
+	}
+#endif
+
+	// clear the screen
+	memset(gFrameBuffer, 0, sizeof(gFrameBuffer));
+
+	if(gLowBattery && !gLowBatteryConfirmed) {
+		UI_DisplayPopup("LOW BATTERY");
+		ST7565_BlitFullScreen();
+		return;
+	}
+
+	if (gEeprom.KEY_LOCK && gKeypadLocked > 0)
+	{	// tell user how to unlock the keyboard
+		UI_PrintString("长按解锁键", 0, LCD_WIDTH, 1, 8);
+		UI_PrintString("以解锁", 0, LCD_WIDTH, 3, 8);
+		ST7565_BlitFullScreen();
+		return;
+	}
+
+	for (vfo_num = 0; vfo_num < 2; vfo_num++)
+		if (!DrawVfo(vfo_num, activeTxVFO))
+			break;
+
+	if (center_line == CENTER_LINE_NONE && !DrawCenterLine())
+		return;
+
+	ST7565_BlitFullScreen();
+}
+
 // ***************************************************************************
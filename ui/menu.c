@@ -38,104 +38,104 @@
 
 const t_menu_item MenuList[] =
 {
-//   text,     voice ID,                               menu ID
-	{"步频",   VOICE_ID_FREQUENCY_STEP,                MENU_STEP          },
-	{"功率",  VOICE_ID_POWER,                         MENU_TXP           }, // was "TXP"
-	{"RxDCS",  VOICE_ID_DCS,                           MENU_R_DCS         }, // was "R_DCS"
-	{"RxCTCS", VOICE_ID_CTCSS,                         MENU_R_CTCS        }, // was "R_CTCS"
-	{"TxDCS",  VOICE_ID_DCS,                           MENU_T_DCS         }, // was "T_DCS"
-	{"TxCTCS", VOICE_ID_CTCSS,                         MENU_T_CTCS        }, // was "T_CTCS"
-	{"方向", VOICE_ID_TX_OFFSET_FREQUENCY_DIRECTION, MENU_SFT_D         }, // was "SFT_D"
-	{"频差", VOICE_ID_TX_OFFSET_FREQUENCY,           MENU_OFFSET        }, // was "OFFSET"
-	{"带宽",    VOICE_ID_CHANNEL_BANDWIDTH,             MENU_W_N           },
-	{"扰频", VOICE_ID_SCRAMBLER_ON,                  MENU_SCR           }, // was "SCR"
-	{"忙锁", VOICE_ID_BUSY_LOCKOUT,                  MENU_BCL           }, // was "BCL"
-	{"Compnd", VOICE_ID_INVALID,                       MENU_COMPAND       },
-	{"解码", VOICE_ID_INVALID,                       MENU_AM            }, // was "AM"
-	{"ScAdd1", VOICE_ID_INVALID,                       MENU_S_ADD1        },
-	{"ScAdd2", VOICE_ID_INVALID,                       MENU_S_ADD2        },
-	{"存储", VOICE_ID_MEMORY_CHANNEL,                MENU_MEM_CH        }, // was "MEM-CH"
-	{"删除", VOICE_ID_DELETE_CHANNEL,                MENU_DEL_CH        }, // was "DEL-CH"
-	{"名称", VOICE_ID_INVALID,                       MENU_MEM_NAME      },	
-
-	{"SList",  VOICE_ID_INVALID,                       MENU_S_LIST        },
-	{"SList1", VOICE_ID_INVALID,                       MENU_SLIST1        },
-	{"SList2", VOICE_ID_INVALID,                       MENU_SLIST2        },
-	{"ScnRev", VOICE_ID_INVALID,                       MENU_SC_REV        },
+//           text,     voice ID,                               menu ID
+	MENU_ITEM("步频",   VOICE_ID_FREQUENCY_STEP,                MENU_STEP          ),
+	MENU_ITEM("功率",  VOICE_ID_POWER,                         MENU_TXP           ), // was "TXP"
+	MENU_ITEM("RxDCS",  VOICE_ID_DCS,                           MENU_R_DCS         ), // was "R_DCS"
+	MENU_ITEM("RxCTCS", VOICE_ID_CTCSS,                         MENU_R_CTCS        ), // was "R_CTCS"
+	MENU_ITEM("TxDCS",  VOICE_ID_DCS,                           MENU_T_DCS         ), // was "T_DCS"
+	MENU_ITEM("TxCTCS", VOICE_ID_CTCSS,                         MENU_T_CTCS        ), // was "T_CTCS"
+	MENU_ITEM("方向", VOICE_ID_TX_OFFSET_FREQUENCY_DIRECTION, MENU_SFT_D         ), // was "SFT_D"
+	MENU_ITEM("频差", VOICE_ID_TX_OFFSET_FREQUENCY,           MENU_OFFSET        ), // was "OFFSET"
+	MENU_ITEM("带宽",    VOICE_ID_CHANNEL_BANDWIDTH,             MENU_W_N           ),
+	MENU_ITEM("扰频", VOICE_ID_SCRAMBLER_ON,                  MENU_SCR           ), // was "SCR"
+	MENU_ITEM("忙锁", VOICE_ID_BUSY_LOCKOUT,                  MENU_BCL           ), // was "BCL"
+	MENU_ITEM("Compnd", VOICE_ID_INVALID,                       MENU_COMPAND       ),
+	MENU_ITEM("解码", VOICE_ID_INVALID,                       MENU_AM            ), // was "AM"
+	MENU_ITEM("ScAdd1", VOICE_ID_INVALID,                       MENU_S_ADD1        ),
+	MENU_ITEM("ScAdd2", VOICE_ID_INVALID,                       MENU_S_ADD2        ),
+	MENU_ITEM("存储", VOICE_ID_MEMORY_CHANNEL,                MENU_MEM_CH        ), // was "MEM-CH"
+	MENU_ITEM("删除", VOICE_ID_DELETE_CHANNEL,                MENU_DEL_CH        ), // was "DEL-CH"
+	MENU_ITEM("名称", VOICE_ID_INVALID,                       MENU_MEM_NAME      ),	
+
+	MENU_ITEM("SList",  VOICE_ID_INVALID,                       MENU_S_LIST        ),
+	MENU_ITEM("SList1", VOICE_ID_INVALID,                       MENU_SLIST1        ),
+	MENU_ITEM("SList2", VOICE_ID_INVALID,                       MENU_SLIST2        ),
+	MENU_ITEM("ScnRev", VOICE_ID_INVALID,                       MENU_SC_REV        ),
 #ifdef ENABLE_NOAA
-	{"NOAA-S", VOICE_ID_INVALID,                       MENU_NOAA_S        },
+	MENU_ITEM("NOAA-S", VOICE_ID_INVALID,                       MENU_NOAA_S        ),
 #endif
 
-	{"侧1短",    VOICE_ID_INVALID,                    MENU_F1SHRT        },
-	{"侧1长",    VOICE_ID_INVALID,                    MENU_F1LONG        },
-	{"侧2短",    VOICE_ID_INVALID,                    MENU_F2SHRT        },
-	{"侧2长",    VOICE_ID_INVALID,                    MENU_F2LONG        },
-	{"M长",    VOICE_ID_INVALID,                    MENU_MLONG         },
+	MENU_ITEM("侧1短",    VOICE_ID_INVALID,                    MENU_F1SHRT        ),
+	MENU_ITEM("侧1长",    VOICE_ID_INVALID,                    MENU_F1LONG        ),
+	MENU_ITEM("侧2短",    VOICE_ID_INVALID,                    MENU_F2SHRT        ),
+	MENU_ITEM("侧2长",    VOICE_ID_INVALID,                    MENU_F2LONG        ),
+	MENU_ITEM("M长",    VOICE_ID_INVALID,                    MENU_MLONG         ),
 
-	{"键锁", VOICE_ID_INVALID,                       MENU_AUTOLK        }, // was "AUTOLk"
-	{"TxTOut", VOICE_ID_TRANSMIT_OVER_TIME,            MENU_TOT           }, // was "TOT"
-	{"节电", VOICE_ID_SAVE_MODE,                     MENU_SAVE          }, // was "SAVE"
-	{"话筒",    VOICE_ID_INVALID,                       MENU_MIC           },
+	MENU_ITEM("键锁", VOICE_ID_INVALID,                       MENU_AUTOLK        ), // was "AUTOLk"
+	MENU_ITEM("TxTOut", VOICE_ID_TRANSMIT_OVER_TIME,            MENU_TOT           ), // was "TOT"
+	MENU_ITEM("节电", VOICE_ID_SAVE_MODE,                     MENU_SAVE          ), // was "SAVE"
+	MENU_ITEM("话筒",    VOICE_ID_INVALID,                       MENU_MIC           ),
 #ifdef ENABLE_AUDIO_BAR
-	{"声压", VOICE_ID_INVALID,                       MENU_MIC_BAR       },
+	MENU_ITEM("声压", VOICE_ID_INVALID,                       MENU_MIC_BAR       ),
 #endif		
-	{"屏显", VOICE_ID_INVALID,                       MENU_MDF           }, // was "MDF"
-	{"机显", VOICE_ID_INVALID,                       MENU_PONMSG        },
-	{"样式", VOICE_ID_INVALID,                       MENU_BAT_TXT       },	
-	{"背光", VOICE_ID_INVALID,                       MENU_ABR           }, // was "ABR"
-	{"BLMin",  VOICE_ID_INVALID,                       MENU_ABR_MIN       },
-	{"BLMax",  VOICE_ID_INVALID,                       MENU_ABR_MAX       },
-	{"BltTRX", VOICE_ID_INVALID,                       MENU_ABR_ON_TX_RX  },
-	{"Beep",   VOICE_ID_BEEP_PROMPT,                   MENU_BEEP          },
+	MENU_ITEM("屏显", VOICE_ID_INVALID,                       MENU_MDF           ), // was "MDF"
+	MENU_ITEM("机显", VOICE_ID_INVALID,                       MENU_PONMSG        ),
+	MENU_ITEM("样式", VOICE_ID_INVALID,                       MENU_BAT_TXT       ),	
+	MENU_ITEM("背光", VOICE_ID_INVALID,                       MENU_ABR           ), // was "ABR"
+	MENU_ITEM("BLMin",  VOICE_ID_INVALID,                       MENU_ABR_MIN       ),
+	MENU_ITEM("BLMax",  VOICE_ID_INVALID,                       MENU_ABR_MAX       ),
+	MENU_ITEM("BltTRX", VOICE_ID_INVALID,                       MENU_ABR_ON_TX_RX  ),
+	MENU_ITEM("Beep",   VOICE_ID_BEEP_PROMPT,                   MENU_BEEP          ),
 #ifdef ENABLE_VOICE
-	{"语音",  VOICE_ID_VOICE_PROMPT,                  MENU_VOICE         },
+	MENU_ITEM("语音",  VOICE_ID_VOICE_PROMPT,                  MENU_VOICE         ),
 #endif
-	{"尾音",  VOICE_ID_INVALID,                       MENU_ROGER         },
-	{"消尾",    VOICE_ID_INVALID,                       MENU_STE           },
-	{"RP STE", VOICE_ID_INVALID,                       MENU_RP_STE        },
-	{"1 Call", VOICE_ID_INVALID,                       MENU_1_CALL        },
+	MENU_ITEM("尾音",  VOICE_ID_INVALID,                       MENU_ROGER         ),
+	MENU_ITEM("消尾",    VOICE_ID_INVALID,                       MENU_STE           ),
+	MENU_ITEM("RP STE", VOICE_ID_INVALID,                       MENU_RP_STE        ),
+	MENU_ITEM("1 Call", VOICE_ID_INVALID,                       MENU_1_CALL        ),
 #ifdef ENABLE_ALARM
-	{"AlarmT", VOICE_ID_INVALID,                       MENU_AL_MOD        },
+	MENU_ITEM("AlarmT", VOICE_ID_INVALID,                       MENU_AL_MOD        ),
 #endif
-	{"ANI ID", VOICE_ID_ANI_CODE,                      MENU_ANI_ID        },
-	{"UPCode", VOICE_ID_INVALID,                       MENU_UPCODE        },
-	{"DWCode", VOICE_ID_INVALID,                       MENU_DWCODE        },
-	{"PTT ID", VOICE_ID_INVALID,                       MENU_PTT_ID        },
-	{"D ST",   VOICE_ID_INVALID,                       MENU_D_ST          },
-    {"D Resp", VOICE_ID_INVALID,                       MENU_D_RSP         },
-	{"D Hold", VOICE_ID_INVALID,                       MENU_D_HOLD        },
-	{"D Prel", VOICE_ID_INVALID,                       MENU_D_PRE         },
-	{"D 解", VOICE_ID_INVALID,                       MENU_D_DCD         },
-	{"D List", VOICE_ID_INVALID,                       MENU_D_LIST        },
-	{"D Live", VOICE_ID_INVALID,                       MENU_D_LIVE_DEC    }, // live DTMF decoder
+	MENU_ITEM("ANI ID", VOICE_ID_ANI_CODE,                      MENU_ANI_ID        ),
+	MENU_ITEM("UPCode", VOICE_ID_INVALID,                       MENU_UPCODE        ),
+	MENU_ITEM("DWCode", VOICE_ID_INVALID,                       MENU_DWCODE        ),
+	MENU_ITEM("PTT ID", VOICE_ID_INVALID,                       MENU_PTT_ID        ),
+	MENU_ITEM("D ST",   VOICE_ID_INVALID,                       MENU_D_ST          ),
+    MENU_ITEM("D Resp", VOICE_ID_INVALID,                       MENU_D_RSP         ),
+	MENU_ITEM("D Hold", VOICE_ID_INVALID,                       MENU_D_HOLD        ),
+	MENU_ITEM("D Prel", VOICE_ID_INVALID,                       MENU_D_PRE         ),
+	MENU_ITEM("D 解", VOICE_ID_INVALID,                       MENU_D_DCD         ),
+	MENU_ITEM("D List", VOICE_ID_INVALID,                       MENU_D_LIST        ),
+	MENU_ITEM("D Live", VOICE_ID_INVALID,                       MENU_D_LIVE_DEC    ), // live DTMF decoder
 #ifdef ENABLE_AM_FIX
-	{"AM Fix", VOICE_ID_INVALID,                       MENU_AM_FIX        },
+	MENU_ITEM("AM Fix", VOICE_ID_INVALID,                       MENU_AM_FIX        ),
 #endif
 #ifdef ENABLE_AM_FIX_TEST1
-	{"AM FT1", VOICE_ID_INVALID,                       MENU_AM_FIX_TEST1  },
+	MENU_ITEM("AM FT1", VOICE_ID_INVALID,                       MENU_AM_FIX_TEST1  ),
 #endif
 #ifdef ENABLE_VOX
-	{"声控",    VOICE_ID_VOX,                           MENU_VOX           },
+	MENU_ITEM("声控",    VOICE_ID_VOX,                           MENU_VOX           ),
 #endif
-	{"电池", VOICE_ID_INVALID,                       MENU_VOL           }, // was "VOL"
-	{"模式", VOICE_ID_DUAL_STANDBY,                  MENU_TDR           },
-	{"静噪",    VOICE_ID_SQUELCH,                       MENU_SQL           },
+	MENU_ITEM("电池", VOICE_ID_INVALID,                       MENU_VOL           ), // was "VOL"
+	MENU_ITEM("模式", VOICE_ID_DUAL_STANDBY,                  MENU_TDR           ),
+	MENU_ITEM("静噪",    VOICE_ID_SQUELCH,                       MENU_SQL           ),
 
 	// hidden menu items from here on
 	// enabled if pressing both the PTT and upper side button at power-on
-	{"键锁", VOICE_ID_INVALID,                       MENU_F_LOCK        },
-	{"Tx 200", VOICE_ID_INVALID,                       MENU_200TX         }, // was "200TX"
-	{"Tx 350", VOICE_ID_INVALID,                       MENU_350TX         }, // was "350TX"
-	{"Tx 500", VOICE_ID_INVALID,                       MENU_500TX         }, // was "500TX"
-	{"350 En", VOICE_ID_INVALID,                       MENU_350EN         }, // was "350EN"
-	{"ScraEn", VOICE_ID_INVALID,                       MENU_SCREN         }, // was "SCREN"
-	{"TxEnab", VOICE_ID_INVALID,                       MENU_TX_EN         }, // enable TX
+	MENU_ITEM("键锁", VOICE_ID_INVALID,                       MENU_F_LOCK        ),
+	MENU_ITEM("Tx 200", VOICE_ID_INVALID,                       MENU_200TX         ), // was "200TX"
+	MENU_ITEM("Tx 350", VOICE_ID_INVALID,                       MENU_350TX         ), // was "350TX"
+	MENU_ITEM("Tx 500", VOICE_ID_INVALID,                       MENU_500TX         ), // was "500TX"
+	MENU_ITEM("350 En", VOICE_ID_INVALID,                       MENU_350EN         ), // was "350EN"
+	MENU_ITEM("ScraEn", VOICE_ID_INVALID,                       MENU_SCREN         ), // was "SCREN"
+	MENU_ITEM("TxEnab", VOICE_ID_INVALID,                       MENU_TX_EN         ), // enable TX
 #ifdef ENABLE_F_CAL_MENU
-	{"FrCali", VOICE_ID_INVALID,                       MENU_F_CALI        }, // reference xtal calibration
+	MENU_ITEM("FrCali", VOICE_ID_INVALID,                       MENU_F_CALI        ), // reference xtal calibration
 #endif
-	{"BatCal", VOICE_ID_INVALID,                       MENU_BATCAL        }, // battery voltage calibration
-	{"BatTyp", VOICE_ID_INVALID,                       MENU_BATTYP        }, // battery type 1600/2200mAh
-	{"重置",  VOICE_ID_INITIALISATION,                MENU_RESET         }, // might be better to move this to the hidden menu items ?
+	MENU_ITEM("BatCal", VOICE_ID_INVALID,                       MENU_BATCAL        ), // battery voltage calibration
+	MENU_ITEM("BatTyp", VOICE_ID_INVALID,                       MENU_BATTYP        ), // battery type 1600/2200mAh
+	MENU_ITEM("重置",  VOICE_ID_INITIALISATION,                MENU_RESET         ), // might be better to move this to the hidden menu items ?
 
 	{"",       VOICE_ID_INVALID,                       0xff               }  // end of list - DO NOT delete or move this this
 };
@@ -392,6 +392,27 @@ char    edit_original[17]; // a copy of the text before editing so that we can e
 char    edit[17];
 int     edit_index;
 
+// the channel menus show one name at a time, it's only read again when the selection changes
+static cached_text_t channel_name_cache;
+
+static void PrintMenuName(const unsigned int Index, const uint8_t Line)
+{
+#ifdef ENABLE_MENU_GLYPHS
+	UI_PrintGlyphString(MenuList[Index].name, 0, 0, Line, 8);
+#else
+	UI_PrintString(MenuList[Index].name, 0, 0, Line, 8);
+#endif
+}
+
+static void PrintMenuNameSmall(const unsigned int Index, const uint8_t Line)
+{
+#ifdef ENABLE_MENU_GLYPHS
+	UI_PrintGlyphStringSmall(MenuList[Index].name, 0, 0, Line);
+#else
+	UI_PrintStringSmall(MenuList[Index].name, 0, 0, Line);
+#endif
+}
+
 void UI_DisplayMenu(void)
 {
 	const unsigned int menu_list_width = 6; // max no. of characters on the menu list (left side)
@@ -410,7 +431,7 @@ void UI_DisplayMenu(void)
 		for (i = 0; i < 3; i++)
 			if (gMenuCursor > 0 || i > 0)
 				if ((gMenuListCount - 1) != gMenuCursor || i != 2)
-					UI_PrintString(MenuList[gMenuCursor + i - 1].name, 0, 0, i * 2, 8);
+					PrintMenuName(gMenuCursor + i - 1, i * 2);
 
 		// invert the current menu list item pixels
 		for (i = 0; i < (8 * menu_list_width); i++)
@@ -443,26 +464,26 @@ void UI_DisplayMenu(void)
 			{	// leading menu items - small text
 				const int k = menu_index + i - 2;
 				if (k < 0)
-					UI_PrintStringSmall(MenuList[gMenuListCount + k].name, 0, 0, i);  // wrap-a-round
+					PrintMenuNameSmall(gMenuListCount + k, i);  // wrap-a-round
 				else
 				if (k >= 0 && k < (int)gMenuListCount)
-					UI_PrintStringSmall(MenuList[k].name, 0, 0, i);
+					PrintMenuNameSmall(k, i);
 				i++;
 			}
 
 			// current menu item - keep big n fat
 			if (menu_index >= 0 && menu_index < (int)gMenuListCount)
-				UI_PrintString(MenuList[menu_index].name, 0, 0, 2, 8);
+				PrintMenuName(menu_index, 2);
 			i++;
 
 			while (i < 4)
 			{	// trailing menu item - small text
 				const int k = menu_index + i - 2;
 				if (k >= 0 && k < (int)gMenuListCount)
-					UI_PrintStringSmall(MenuList[k].name, 0, 0, 1 + i);
+					PrintMenuNameSmall(k, 1 + i);
 				else
 				if (k >= (int)gMenuListCount)
-					UI_PrintStringSmall(MenuList[gMenuListCount - k].name, 0, 0, 1 + i);  // wrap-a-round
+					PrintMenuNameSmall(gMenuListCount - k, 1 + i);  // wrap-a-round
 				i++;
 			}
 
@@ -473,10 +494,7 @@ void UI_DisplayMenu(void)
 		else
 		if (menu_index >= 0 && menu_index < (int)gMenuListCount)
 		{	// current menu item
-			strcpy(String, MenuList[menu_index].name);
-//			strcat(String, ":");
-			UI_PrintString(String, 0, 0, 0, 8);
-//			UI_PrintStringSmall(String, 0, 0, 0);
+			PrintMenuName(menu_index, 0);
 		}
 	}
 	#endif
@@ -671,7 +689,7 @@ void UI_DisplayMenu(void)
 
 				if (!gIsInSubMenu || edit_index < 0)
 				{	// show the channel name
-					BOARD_fetchChannelName(String, gSubMenuSelection);
+					strcpy(String, UI_GetCachedChannelName(&channel_name_cache, gSubMenuSelection));
 					if (String[0] == 0)
 						strcpy(String, "--");
 					UI_PrintString(String, menu_item_x1, menu_item_x2, 2, 8);
@@ -912,7 +930,7 @@ void UI_DisplayMenu(void)
 			UI_PrintString(String, menu_item_x1, menu_item_x2, 0, 8);
 
 			// channel name
-			BOARD_fetchChannelName(String, gSubMenuSelection);
+			strcpy(String, UI_GetCachedChannelName(&channel_name_cache, gSubMenuSelection));
 			if (String[0] == 0)
 				strcpy(String, "--");
 			UI_PrintString(String, menu_item_x1, menu_item_x2, 2, 8);
@@ -923,7 +941,7 @@ void UI_DisplayMenu(void)
 			UI_PrintString(String, menu_item_x1, menu_item_x2, 0, 8);
 
 			// channel name
-			BOARD_fetchChannelName(String, gSubMenuSelection);
+			strcpy(String, UI_GetCachedChannelName(&channel_name_cache, gSubMenuSelection));
 			if (String[0] == 0)
 				strcpy(String, "--");
 			UI_PrintStringSmall(String, menu_item_x1, menu_item_x2, 2);
@@ -947,7 +965,7 @@ void UI_DisplayMenu(void)
 	    UI_MENU_GetCurrentMenuId() == MENU_1_CALL)
 	{	// display the channel name
 		char s[11];
-		BOARD_fetchChannelName(s, gSubMenuSelection);
+		strcpy(s, UI_GetCachedChannelName(&channel_name_cache, gSubMenuSelection));
 		if (s[0] == 0)
 			strcpy(s, "--");
 		UI_PrintString(s, menu_item_x1, menu_item_x2, 2, 8);
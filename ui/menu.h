@@ -21,13 +21,28 @@
 #include <stdint.h>
 
 #include "audio.h"     // VOICE_ID_t
+#ifdef ENABLE_MENU_GLYPHS
+	#include "ui/helper.h"
+	#include "ui/menu_glyphs.h"
+#endif
 
 typedef struct {
+#ifdef ENABLE_MENU_GLYPHS
+	const uint8_t name[UI_GLYPH_STRING_SIZE];   // the name already decoded to glyphs, from ui/menu_glyphs.h
+#else
 	const char  name[7];    // menu display area only has room for 6 characters
+#endif
 	VOICE_ID_t  voice_id;
 	uint8_t     menu_id;
 } t_menu_item;
 
+// the name text stays in the source either way, utils/main.cpp reads it from there to build ui/menu_glyphs.h
+#ifdef ENABLE_MENU_GLYPHS
+	#define MENU_ITEM(text, voice_id, menu_id)   {GLYPHS_##menu_id, voice_id, menu_id}
+#else
+	#define MENU_ITEM(text, voice_id, menu_id)   {text, voice_id, menu_id}
+#endif
+
 enum
 {
 	MENU_SQL = 0,
@@ -0,0 +1,83 @@
+// MenuList names as glyph strings - generated by utils/main.cpp from the MENU_ITEM() names in ui/menu.c
+// byte 0 is the UTF-8 length of the name, then the glyph codes
+
+#ifndef UI_MENU_GLYPHS_H
+#define UI_MENU_GLYPHS_H
+
+#define GLYPHS_MENU_STEP           {6, 0x93, 0x84, 0x00, 0x00, 0x00, 0x00}   // 步频
+#define GLYPHS_MENU_TXP            {6, 0x90, 0x85, 0x00, 0x00, 0x00, 0x00}   // 功率
+#define GLYPHS_MENU_R_DCS          {5, 0x33, 0x59, 0x25, 0x24, 0x34, 0x00}   // RxDCS
+#define GLYPHS_MENU_R_CTCS         {6, 0x33, 0x59, 0x24, 0x35, 0x24, 0x34}   // RxCTCS
+#define GLYPHS_MENU_T_DCS          {5, 0x35, 0x59, 0x25, 0x24, 0x34, 0x00}   // TxDCS
+#define GLYPHS_MENU_T_CTCS         {6, 0x35, 0x59, 0x24, 0x35, 0x24, 0x34}   // TxCTCS
+#define GLYPHS_MENU_SFT_D          {6, 0xC1, 0xC2, 0x00, 0x00, 0x00, 0x00}   // 方向
+#define GLYPHS_MENU_OFFSET         {6, 0x84, 0x97, 0x00, 0x00, 0x00, 0x00}   // 频差
+#define GLYPHS_MENU_W_N            {6, 0xA8, 0xA9, 0x00, 0x00, 0x00, 0x00}   // 带宽
+#define GLYPHS_MENU_SCR            {6, 0x73, 0x84, 0x00, 0x00, 0x00, 0x00}   // 扰频
+#define GLYPHS_MENU_BCL            {6, 0x60, 0x81, 0x00, 0x00, 0x00, 0x00}   // 忙锁
+#define GLYPHS_MENU_COMPAND        {6, 0x24, 0x50, 0x4E, 0x51, 0x4F, 0x45}   // Compnd
+#define GLYPHS_MENU_AM             {6, 0x64, 0x65, 0x00, 0x00, 0x00, 0x00}   // 解码
+#define GLYPHS_MENU_S_ADD1         {6, 0x34, 0x44, 0x22, 0x45, 0x45, 0x12}   // ScAdd1
+#define GLYPHS_MENU_S_ADD2         {6, 0x34, 0x44, 0x22, 0x45, 0x45, 0x13}   // ScAdd2
+#define GLYPHS_MENU_MEM_CH         {6, 0x9D, 0xA7, 0x00, 0x00, 0x00, 0x00}   // 存储
+#define GLYPHS_MENU_DEL_CH         {6, 0x9E, 0x9F, 0x00, 0x00, 0x00, 0x00}   // 删除
+#define GLYPHS_MENU_MEM_NAME       {6, 0xA0, 0xA2, 0x00, 0x00, 0x00, 0x00}   // 名称
+#define GLYPHS_MENU_S_LIST         {5, 0x34, 0x2D, 0x4A, 0x54, 0x55, 0x00}   // SList
+#define GLYPHS_MENU_SLIST1         {6, 0x34, 0x2D, 0x4A, 0x54, 0x55, 0x12}   // SList1
+#define GLYPHS_MENU_SLIST2         {6, 0x34, 0x2D, 0x4A, 0x54, 0x55, 0x13}   // SList2
+#define GLYPHS_MENU_SC_REV         {6, 0x34, 0x44, 0x4F, 0x33, 0x46, 0x57}   // ScnRev
+#define GLYPHS_MENU_NOAA_S         {6, 0x2F, 0x30, 0x22, 0x22, 0x0E, 0x34}   // NOAA-S
+#define GLYPHS_MENU_F1SHRT         {7, 0x6E, 0x12, 0x7F, 0x00, 0x00, 0x00}   // 侧1短
+#define GLYPHS_MENU_F1LONG         {7, 0x6E, 0x12, 0x7E, 0x00, 0x00, 0x00}   // 侧1长
+#define GLYPHS_MENU_F2SHRT         {7, 0x6E, 0x13, 0x7F, 0x00, 0x00, 0x00}   // 侧2短
+#define GLYPHS_MENU_F2LONG         {7, 0x6E, 0x13, 0x7E, 0x00, 0x00, 0x00}   // 侧2长
+#define GLYPHS_MENU_MLONG          {4, 0x2E, 0x7E, 0x00, 0x00, 0x00, 0x00}   // M长
+#define GLYPHS_MENU_AUTOLK         {6, 0x79, 0x81, 0x00, 0x00, 0x00, 0x00}   // 键锁
+#define GLYPHS_MENU_TOT            {6, 0x35, 0x59, 0x35, 0x30, 0x56, 0x55}   // TxTOut
+#define GLYPHS_MENU_SAVE           {6, 0x63, 0xBA, 0x00, 0x00, 0x00, 0x00}   // 节电
+#define GLYPHS_MENU_MIC            {6, 0xC3, 0xC4, 0x00, 0x00, 0x00, 0x00}   // 话筒
+#define GLYPHS_MENU_MIC_BAR        {6, 0xA6, 0xA5, 0x00, 0x00, 0x00, 0x00}   // 声压
+#define GLYPHS_MENU_MDF            {6, 0xC5, 0xA3, 0x00, 0x00, 0x00, 0x00}   // 屏显
+#define GLYPHS_MENU_PONMSG         {6, 0x62, 0xA3, 0x00, 0x00, 0x00, 0x00}   // 机显
+#define GLYPHS_MENU_BAT_TXT        {6, 0x71, 0x72, 0x00, 0x00, 0x00, 0x00}   // 样式
+#define GLYPHS_MENU_ABR            {6, 0x91, 0x92, 0x00, 0x00, 0x00, 0x00}   // 背光
+#define GLYPHS_MENU_ABR_MIN        {5, 0x23, 0x2D, 0x2E, 0x4A, 0x4F, 0x00}   // BLMin
+#define GLYPHS_MENU_ABR_MAX        {5, 0x23, 0x2D, 0x2E, 0x42, 0x59, 0x00}   // BLMax
+#define GLYPHS_MENU_ABR_ON_TX_RX   {6, 0x23, 0x4D, 0x55, 0x35, 0x33, 0x39}   // BltTRX
+#define GLYPHS_MENU_BEEP           {4, 0x23, 0x46, 0x46, 0x51, 0x00, 0x00}   // Beep
+#define GLYPHS_MENU_VOICE          {6, 0xC6, 0x8F, 0x00, 0x00, 0x00, 0x00}   // 语音
+#define GLYPHS_MENU_ROGER          {6, 0x98, 0x8F, 0x00, 0x00, 0x00, 0x00}   // 尾音
+#define GLYPHS_MENU_STE            {6, 0x66, 0x98, 0x00, 0x00, 0x00, 0x00}   // 消尾
+#define GLYPHS_MENU_RP_STE         {6, 0x33, 0x31, 0x01, 0x34, 0x35, 0x26}   // RP STE
+#define GLYPHS_MENU_1_CALL         {6, 0x12, 0x01, 0x24, 0x42, 0x4D, 0x4D}   // 1 Call
+#define GLYPHS_MENU_AL_MOD         {6, 0x22, 0x4D, 0x42, 0x53, 0x4E, 0x35}   // AlarmT
+#define GLYPHS_MENU_ANI_ID         {6, 0x22, 0x2F, 0x2A, 0x01, 0x2A, 0x25}   // ANI ID
+#define GLYPHS_MENU_UPCODE         {6, 0x36, 0x31, 0x24, 0x50, 0x45, 0x46}   // UPCode
+#define GLYPHS_MENU_DWCODE         {6, 0x25, 0x38, 0x24, 0x50, 0x45, 0x46}   // DWCode
+#define GLYPHS_MENU_PTT_ID         {6, 0x31, 0x35, 0x35, 0x01, 0x2A, 0x25}   // PTT ID
+#define GLYPHS_MENU_D_ST           {4, 0x25, 0x01, 0x34, 0x35, 0x00, 0x00}   // D ST
+#define GLYPHS_MENU_D_RSP          {6, 0x25, 0x01, 0x33, 0x46, 0x54, 0x51}   // D Resp
+#define GLYPHS_MENU_D_HOLD         {6, 0x25, 0x01, 0x29, 0x50, 0x4D, 0x45}   // D Hold
+#define GLYPHS_MENU_D_PRE          {6, 0x25, 0x01, 0x31, 0x53, 0x46, 0x4D}   // D Prel
+#define GLYPHS_MENU_D_DCD          {5, 0x25, 0x01, 0x64, 0x00, 0x00, 0x00}   // D 解
+#define GLYPHS_MENU_D_LIST         {6, 0x25, 0x01, 0x2D, 0x4A, 0x54, 0x55}   // D List
+#define GLYPHS_MENU_D_LIVE_DEC     {6, 0x25, 0x01, 0x2D, 0x4A, 0x57, 0x46}   // D Live
+#define GLYPHS_MENU_AM_FIX         {6, 0x22, 0x2E, 0x01, 0x27, 0x4A, 0x59}   // AM Fix
+#define GLYPHS_MENU_AM_FIX_TEST1   {6, 0x22, 0x2E, 0x01, 0x27, 0x35, 0x12}   // AM FT1
+#define GLYPHS_MENU_VOX            {6, 0xA6, 0xDD, 0x00, 0x00, 0x00, 0x00}   // 声控
+#define GLYPHS_MENU_VOL            {6, 0xBA, 0x61, 0x00, 0x00, 0x00, 0x00}   // 电池
+#define GLYPHS_MENU_TDR            {6, 0x99, 0x72, 0x00, 0x00, 0x00, 0x00}   // 模式
+#define GLYPHS_MENU_SQL            {6, 0x7A, 0x7B, 0x00, 0x00, 0x00, 0x00}   // 静噪
+#define GLYPHS_MENU_F_LOCK         {6, 0x79, 0x81, 0x00, 0x00, 0x00, 0x00}   // 键锁
+#define GLYPHS_MENU_200TX          {6, 0x35, 0x59, 0x01, 0x13, 0x11, 0x11}   // Tx 200
+#define GLYPHS_MENU_350TX          {6, 0x35, 0x59, 0x01, 0x14, 0x16, 0x11}   // Tx 350
+#define GLYPHS_MENU_500TX          {6, 0x35, 0x59, 0x01, 0x16, 0x11, 0x11}   // Tx 500
+#define GLYPHS_MENU_350EN          {6, 0x14, 0x16, 0x11, 0x01, 0x26, 0x4F}   // 350 En
+#define GLYPHS_MENU_SCREN          {6, 0x34, 0x44, 0x53, 0x42, 0x26, 0x4F}   // ScraEn
+#define GLYPHS_MENU_TX_EN          {6, 0x35, 0x59, 0x26, 0x4F, 0x42, 0x43}   // TxEnab
+#define GLYPHS_MENU_F_CALI         {6, 0x27, 0x53, 0x24, 0x42, 0x4D, 0x4A}   // FrCali
+#define GLYPHS_MENU_BATCAL         {6, 0x23, 0x42, 0x55, 0x24, 0x42, 0x4D}   // BatCal
+#define GLYPHS_MENU_BATTYP         {6, 0x23, 0x42, 0x55, 0x35, 0x5A, 0x51}   // BatTyp
+#define GLYPHS_MENU_RESET          {6, 0xC7, 0xC8, 0x00, 0x00, 0x00, 0x00}   // 重置
+
+#endif
@@ -26,7 +26,7 @@
 
 void UI_DisplayScanner(void)
 {
-	char    String[16];
+	char    String[24];   // "模拟亚音:" alone is 13 bytes in UTF-8
 	bool    bCentered;
 	uint8_t Start;
 
@@ -23,6 +23,7 @@
 #endif
 #include "driver/keyboard.h"
 #include "misc.h"
+#include "settings.h"
 #ifdef ENABLE_AIRCOPY
 	#include "ui/aircopy.h"
 #endif
@@ -33,6 +34,7 @@
 #include "ui/main.h"
 #include "ui/menu.h"
 #include "ui/scanner.h"
+#include "ui/status.h"
 #include "ui/ui.h"
 
 GUI_DisplayType_t gScreenToDisplay;
@@ -42,6 +44,28 @@ uint8_t           gAskForConfirmation;
 bool              gAskToSave;
 bool              gAskToDelete;
 
+#ifdef ENABLE_REDRAW_GOVERNOR
+	GUI_RedrawStats_t gRedrawStats;
+
+	// minimum time between two redraws of each screen, in 10ms ticks
+	static const uint8_t ScreenRedrawInterval_10ms[] =
+	{
+		[DISPLAY_MAIN]    = 5,     // 20 fps
+		[DISPLAY_FM]      = 10,    // 10 fps
+		[DISPLAY_MENU]    = 2,     // 50 fps, keep the key presses snappy
+		[DISPLAY_SCANNER] = 5,     // 20 fps
+		[DISPLAY_AIRCOPY] = 10     // 10 fps
+	};
+
+	// the status line has its own budget so a busy main screen can't hold it back
+	#define STATUS_REDRAW_INTERVAL_10ms   10
+
+	static GUI_DisplayType_t gLastDrawnScreen = DISPLAY_INVALID;
+	static uint8_t           gScreenRedrawCountdown_10ms;
+	static bool              gScreenRedrawDeferred;
+	static uint8_t           gStatusRedrawCountdown_10ms;
+#endif
+
 void GUI_DisplayScreen(void)
 {
 	switch (gScreenToDisplay)
@@ -75,6 +99,81 @@ void GUI_DisplayScreen(void)
 	}
 }
 
+void GUI_ServiceRedraw(void)
+{	// called every 10ms, draws whatever has been asked for since the last call
+#ifdef ENABLE_STAGED_BOOT
+	static bool WelcomeOnScreen;
+
+	if (boot_counter_10ms > 0 && gEeprom.POWER_ON_DISPLAY_MODE != POWER_ON_DISPLAY_MODE_NONE)
+	{	// the radio is already running underneath the welcome screen, leave it up until it times out
+		WelcomeOnScreen = true;
+		return;
+	}
+
+	if (WelcomeOnScreen)
+	{
+		WelcomeOnScreen = false;
+		gUpdateDisplay  = true;
+		gUpdateStatus   = true;
+	}
+#endif
+
+#ifdef ENABLE_REDRAW_GOVERNOR
+	if (gScreenRedrawCountdown_10ms > 0)
+		gScreenRedrawCountdown_10ms--;
+
+	if (gStatusRedrawCountdown_10ms > 0)
+		gStatusRedrawCountdown_10ms--;
+
+	if (gUpdateDisplay)
+	{
+		const bool NewScreen = (gScreenToDisplay != gLastDrawnScreen);
+
+		if (!NewScreen && gScreenRedrawCountdown_10ms > 0)
+		{	// any further requests until the countdown runs out land in the same frame
+			gRedrawStats.Merged++;
+			gScreenRedrawDeferred = true;
+		}
+		else
+		{	// a new screen is always drawn straight away
+			if (NewScreen && gScreenRedrawDeferred)
+				gRedrawStats.Dropped++;   // the old screen never got its pending frame
+
+			gUpdateDisplay = false;
+			GUI_DisplayScreen();
+
+			gScreenRedrawDeferred       = false;
+			gLastDrawnScreen            = gScreenToDisplay;
+			gScreenRedrawCountdown_10ms = (gScreenToDisplay < ARRAY_SIZE(ScreenRedrawInterval_10ms)) ? ScreenRedrawInterval_10ms[gScreenToDisplay] : 0;
+			gRedrawStats.Frames++;
+		}
+	}
+
+	if (gUpdateStatus)
+	{
+		if (gStatusRedrawCountdown_10ms > 0)
+		{
+			gRedrawStats.StatusMerged++;
+			return;
+		}
+
+		UI_DisplayStatus();
+
+		gStatusRedrawCountdown_10ms = STATUS_REDRAW_INTERVAL_10ms;
+		gRedrawStats.StatusFrames++;
+	}
+#else
+	if (gUpdateDisplay)
+	{
+		gUpdateDisplay = false;
+		GUI_DisplayScreen();
+	}
+
+	if (gUpdateStatus)
+		UI_DisplayStatus();
+#endif
+}
+
 void GUI_SelectNextDisplay(GUI_DisplayType_t Display)
 {
 	if (Display == DISPLAY_INVALID)
@@ -87,6 +186,9 @@ void GUI_SelectNextDisplay(GUI_DisplayType_t Display)
 		gInputBoxIndex       = 0;
 		gIsInSubMenu         = false;
 		gCssBackgroundScan         = false;
+		#ifdef ENABLE_SCAN_PLAN
+			CHFRSCANNER_Cancel();
+		#endif
 		gScanStateDir        = SCAN_OFF;
 		#ifdef ENABLE_FMRADIO
 			gFM_ScanState    = FM_SCAN_OFF;
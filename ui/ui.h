@@ -39,7 +39,20 @@ extern uint8_t           gAskForConfirmation;
 extern bool              gAskToSave;
 extern bool              gAskToDelete;
 
+#ifdef ENABLE_REDRAW_GOVERNOR
+	typedef struct {
+		uint32_t Frames;          // main screen redraws
+		uint32_t Merged;          // 10ms ticks a main screen request waited for the frame rate limit
+		uint32_t Dropped;         // pending frames thrown away because the screen changed
+		uint32_t StatusFrames;    // status line redraws
+		uint32_t StatusMerged;    // 10ms ticks a status line request waited for the frame rate limit
+	} GUI_RedrawStats_t;
+
+	extern GUI_RedrawStats_t gRedrawStats;
+#endif
+
 void GUI_DisplayScreen(void);
+void GUI_ServiceRedraw(void);
 void GUI_SelectNextDisplay(GUI_DisplayType_t Display);
 
 #endif
@@ -0,0 +1,164 @@
+/* Host test of the BK4819 3-wire bus (driver/bk4819.c) against the model chip in utils/mock_bk4819.h,
+ * once for each bus path:
+ *
+ *   gcc -O2 -I. utils/bk4819_bus_test.c -o bk4819_bus_test && ./bk4819_bus_test
+ *   gcc -O2 -I. -DENABLE_BK4819_FAST_BUS utils/bk4819_bus_test.c -o bk4819_bus_test && ./bk4819_bus_test
+ *
+ * Writes and reads back a spread of register values, then checks the chip saw every transaction
+ * whole and no edge came sooner than the model's minimum times. GPIO accesses take no time in the
+ * model, so only the driver's own delays count towards those times.
+ *
+ * Last it prints an estimate of register accesses per second on the radio: the model time of a
+ * transaction plus MOCK_GPIO_ACCESS_CYCLES for each GPIO access. That's an estimate from cycle counts,
+ * a lower bound on the time with no flash wait states or call overhead, not a measurement.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "utils/mock_bk4819.h"
+#include "driver/bk4819.c"
+
+// an ldr, an orr/bic and a str on the Cortex-M0
+#define MOCK_GPIO_ACCESS_CYCLES  5u
+
+static unsigned int gFailures;
+
+static void Check(const bool bOk, const char *pWhat)
+{
+	printf("%-52s %s\n", pWhat, bOk ? "ok" : "FAIL");
+	if (!bOk)
+		gFailures++;
+}
+
+// driver/system.c stand-in
+void SYSTEM_DelayMs(uint32_t Delay)
+{
+	MockBk4819_Wait(Delay * 1000u * SYSTICK_CPU_MHZ);
+}
+
+static const uint16_t gValues[] = { 0x0000, 0xFFFF, 0xA5A5, 0x5A5A, 0x8001, 0x7FFE, 0x1234, 0xFEDC };
+
+static void TestWrites(void)
+{
+	unsigned int i;
+	bool         bOk = true;
+
+	MockBk4819_Reset();
+
+	for (i = 0; i < ARRAY_SIZE(gValues); i++)
+	{
+		const unsigned int Register = 0x30 + (i * 9);
+
+		BK4819_WriteRegister(Register, gValues[i]);
+		MockBk4819_Sync();
+
+		if (gMockBk4819.Reg[Register] != gValues[i])
+			bOk = false;
+	}
+
+	Check(bOk, "writes: the chip got every value");
+	Check(gMockBk4819.Writes == ARRAY_SIZE(gValues), "writes: one transaction each");
+	Check(gMockBk4819.BadTransactions == 0, "writes: 24 clocks in every transaction");
+}
+
+static void TestReads(void)
+{
+	unsigned int i;
+	bool         bOk = true;
+
+	MockBk4819_Reset();
+
+	for (i = 0; i < ARRAY_SIZE(gValues); i++)
+		gMockBk4819.Reg[0x0C + i] = gValues[i];
+
+	for (i = 0; i < ARRAY_SIZE(gValues); i++)
+	{
+		if (BK4819_ReadRegister(0x0C + i) != gValues[i])
+			bOk = false;
+		MockBk4819_Sync();
+	}
+
+	Check(bOk, "reads: every value came back");
+	Check(gMockBk4819.Reads == ARRAY_SIZE(gValues), "reads: one transaction each");
+	Check(gMockBk4819.BadTransactions == 0, "reads: 24 clocks in every transaction");
+	Check(gMockPortcIe == PORTCON_PORTC_IE_C2_BITS_DISABLE, "reads: SDA input buffer off again");
+	Check((gMockGpioC.DIR & GPIO_DIR_2_MASK) == GPIO_DIR_2_BITS_OUTPUT, "reads: SDA back to an output");
+}
+
+static void TestTiming(void)
+{
+	unsigned int i;
+
+	MockBk4819_Reset();
+
+	for (i = 0; i < ARRAY_SIZE(gValues); i++)
+	{
+		BK4819_WriteRegister(0x40 + i, gValues[i]);
+		BK4819_ReadRegister(0x40 + i);
+	}
+	MockBk4819_Sync();
+
+	for (i = 0; i < MOCK_BK4819_TIMINGS; i++)
+	{
+		char What[96];
+
+		snprintf(What, sizeof(What), "timing: %-9s shortest %4lluns, needs %4lluns",
+			gMockTimingName[i],
+			(unsigned long long)MOCK_CYCLES_TO_NS(gMockBk4819.Shortest[i]),
+			(unsigned long long)MOCK_CYCLES_TO_NS(gMockMinimum[i]));
+		Check(gMockBk4819.Violations[i] == 0, What);
+	}
+}
+
+static void Estimate(const char *pWhat, const uint64_t Cycles, const uint32_t Accesses)
+{
+	const uint64_t Total = Cycles + ((uint64_t)Accesses * MOCK_GPIO_ACCESS_CYCLES);
+	const double   us    = (double)Total / SYSTICK_CPU_MHZ;
+
+	printf("%-6s %5llu delay cycles + %3u GPIO accesses = %6.1fus, about %6.0f per second\n",
+		pWhat, (unsigned long long)Cycles, Accesses, us, 1e6 / us);
+}
+
+static void Benchmark(void)
+{
+	uint64_t Cycles;
+	uint32_t Accesses;
+
+#ifdef ENABLE_BK4819_FAST_BUS
+	printf("\nestimated register accesses with ENABLE_BK4819_FAST_BUS\n");
+#else
+	printf("\nestimated register accesses with SYSTICK_DelayUs(1) delays\n");
+#endif
+
+	MockBk4819_Reset();
+
+	Cycles   = gMockCycles;
+	Accesses = gMockGpioAccesses;
+	BK4819_WriteRegister(BK4819_REG_30, 0x1234);
+	MockBk4819_Sync();
+	Estimate("write", gMockCycles - Cycles, gMockGpioAccesses - Accesses);
+
+	Cycles   = gMockCycles;
+	Accesses = gMockGpioAccesses;
+	BK4819_ReadRegister(BK4819_REG_30);
+	MockBk4819_Sync();
+	Estimate("read", gMockCycles - Cycles, gMockGpioAccesses - Accesses);
+}
+
+int main(void)
+{
+	TestWrites();
+	TestReads();
+	TestTiming();
+	Benchmark();
+
+	if (gFailures > 0)
+	{
+		printf("%u failed\n", gFailures);
+		return EXIT_FAILURE;
+	}
+
+	printf("all passed\n");
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,259 @@
+/* Host test of the BK4819 register shadow (ENABLE_BK4819_SHADOW in driver/bk4819.c), on the fake bus
+ * and model chip in utils/mock_bk4819.h:
+ *
+ *   gcc -O2 -I. utils/bk4819_shadow_test.c -o bk4819_shadow_test && ./bk4819_shadow_test
+ *
+ * The model chip counts the transactions that really went over the bus, so every register read and
+ * write the code asked for is either one of those or one of the saved ones in gBK4819_ShadowStats.
+ * The checks hold the shadow to that, and to the chip ending up with the values the code wrote.
+ *
+ * Last it runs a channel retune a few times and a frequency scan, the way radio.c drives the chip,
+ * and prints how many transactions the shadow saved.
+ */
+
+#ifndef ENABLE_BK4819_SHADOW
+	#define ENABLE_BK4819_SHADOW
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "utils/mock_bk4819.h"
+#include "driver/bk4819.c"
+
+static unsigned int gFailures;
+
+static void Check(const bool bOk, const char *pWhat)
+{
+	printf("%-56s %s\n", pWhat, bOk ? "ok" : "FAIL");
+	if (!bOk)
+		gFailures++;
+}
+
+// driver/system.c stand-in
+void SYSTEM_DelayMs(uint32_t Delay)
+{
+	MockBk4819_Wait(Delay * 1000u * SYSTICK_CPU_MHZ);
+}
+
+static void Reset(void)
+{	// a soft reset empties the shadow, then start the counts from nothing
+	MockBk4819_Reset();
+	BK4819_WriteRegister(BK4819_REG_00, 0);
+	MockBk4819_Reset();
+	memset(&gBK4819_ShadowStats, 0, sizeof(gBK4819_ShadowStats));
+}
+
+static void TestReads(void)
+{
+	unsigned int i;
+	bool         bOk = true;
+
+	Reset();
+
+	BK4819_WriteRegister(BK4819_REG_47, 0x6040);
+	for (i = 0; i < 10; i++)
+		if (BK4819_ReadRegister(BK4819_REG_47) != 0x6040)
+			bOk = false;
+
+	Check(bOk, "reads: a written register reads back from the shadow");
+	Check(gMockBk4819.Reads == 0 && gBK4819_ShadowStats.ReadsSaved == 10, "reads: none of them on the bus");
+
+	gMockBk4819.Reg[BK4819_REG_0C] = 0x1234;
+	BK4819_WriteRegister(BK4819_REG_0C, 0);
+	gMockBk4819.Reg[BK4819_REG_0C] = 0x1234;     // a status register, it changes on its own
+	for (i = 0; i < 10; i++)
+		if (BK4819_ReadRegister(BK4819_REG_0C) != 0x1234)
+			bOk = false;
+
+	Check(bOk, "reads: a status register comes from the chip");
+	Check(gMockBk4819.Reads == 10 && gBK4819_ShadowStats.ReadsSaved == 10, "reads: all of them on the bus");
+
+	BK4819_WriteRegister(BK4819_REG_00, 0x8000);
+	gMockBk4819.Reg[BK4819_REG_47] = 0x4040;     // the chip's default after a soft reset
+	Check(BK4819_ReadRegister(BK4819_REG_47) == 0x4040, "reads: a soft reset empties the shadow");
+}
+
+static void TestWrites(void)
+{
+	unsigned int i;
+
+	Reset();
+
+	BK4819_UpdateRegister(BK4819_REG_38, 0x1111);
+	Check(gMockBk4819.Writes == 1, "writes: the first update goes on the bus");
+
+	for (i = 0; i < 10; i++)
+		BK4819_UpdateRegister(BK4819_REG_38, 0x1111);
+	Check(gMockBk4819.Writes == 1 && gBK4819_ShadowStats.WritesSaved == 10, "writes: updates to the same value don't");
+
+	BK4819_UpdateRegister(BK4819_REG_38, 0x2222);
+	Check(gMockBk4819.Writes == 2 && gMockBk4819.Reg[BK4819_REG_38] == 0x2222, "writes: a new value does");
+
+	for (i = 0; i < 10; i++)
+		BK4819_WriteRegister(BK4819_REG_38, 0x2222);
+	Check(gMockBk4819.Writes == 12, "writes: BK4819_WriteRegister() always does");
+
+	BK4819_UpdateRegisterBits(BK4819_REG_38, 0x00F0, 0x0020);
+	BK4819_UpdateRegisterBits(BK4819_REG_38, 0x00F0, 0x0050);
+	Check(gMockBk4819.Reads == 0 && gMockBk4819.Writes == 13 && gMockBk4819.Reg[BK4819_REG_38] == 0x2252,
+		"writes: read-modify-write reads the shadow");
+}
+
+static void TestBatch(void)
+{
+	Reset();
+
+	BK4819_WriteRegister(BK4819_REG_38, 0);
+	BK4819_WriteRegister(BK4819_REG_39, 0);
+	BK4819_WriteRegister(BK4819_REG_47, 0);
+	MockBk4819_Reset();
+
+	BK4819_BeginBatch();
+	BK4819_UpdateRegister(BK4819_REG_47, 0x0001);
+	BK4819_UpdateRegister(BK4819_REG_38, 0x0001);
+	BK4819_UpdateRegister(BK4819_REG_38, 0x0002);
+	BK4819_UpdateRegister(BK4819_REG_38, 0x0003);
+	BK4819_UpdateRegister(BK4819_REG_39, 0x0000);
+	Check(gMockBk4819.Writes == 0, "batch: nothing on the bus before the commit");
+	Check(BK4819_ReadRegister(BK4819_REG_38) == 0x0003, "batch: reads see the held back value");
+
+	BK4819_CommitBatch();
+	Check(gMockBk4819.Writes == 2, "batch: one write for each changed register");
+	Check(gMockBk4819.Reg[BK4819_REG_38] == 0x0003 && gMockBk4819.Reg[BK4819_REG_47] == 0x0001,
+		"batch: the chip has the last values");
+	Check(gBK4819_ShadowStats.WritesSaved == 3, "batch: the other three counted as saved");
+
+	BK4819_UpdateRegister(BK4819_REG_38, 0x0004);
+	Check(gMockBk4819.Writes == 3, "batch: updates go straight out after the commit");
+}
+
+static void TestRandom(void)
+{	// every read and update the code asks for is either a bus transaction or a saved one, and the
+	// shadow never disagrees with the chip
+	static const BK4819_REGISTER_t Registers[] =
+	{
+		BK4819_REG_31, BK4819_REG_36, BK4819_REG_38, BK4819_REG_39, BK4819_REG_43, BK4819_REG_47,
+		BK4819_REG_4D, BK4819_REG_4E, BK4819_REG_70, BK4819_REG_78, BK4819_REG_0C, BK4819_REG_30
+	};
+
+	uint32_t     Seed     = 12345;
+	uint32_t     Reads    = 0;
+	uint32_t     Updates  = 0;
+	uint32_t     Writes   = 0;
+	bool         bBatch   = false;
+	bool         bOk      = true;
+	unsigned int i;
+
+	Reset();
+
+	for (i = 0; i < 20000; i++)
+	{
+		const BK4819_REGISTER_t Register = Registers[(Seed >> 8) % ARRAY_SIZE(Registers)];
+		const uint16_t          Data     = (Seed >> 20) & 3u;   // few values, so plenty of repeats
+
+		Seed = (Seed * 1103515245u) + 12345u;
+
+		switch ((Seed >> 16) % 8)
+		{
+			case 0:
+			case 1:
+			case 2:
+			{
+				const uint16_t Value = BK4819_ReadRegister(Register);
+
+				MockBk4819_Sync();
+				if (Value != gMockBk4819.Reg[Register] && !bBatch)
+					bOk = false;
+				Reads++;
+				break;
+			}
+			case 3:
+				BK4819_WriteRegister(Register, Data);
+				Writes++;
+				break;
+			case 4:
+				if (!bBatch)
+					BK4819_BeginBatch();
+				else
+					BK4819_CommitBatch();
+				bBatch = !bBatch;
+				break;
+			default:
+				BK4819_UpdateRegister(Register, Data);
+				Updates++;
+				break;
+		}
+	}
+
+	if (bBatch)
+		BK4819_CommitBatch();
+	MockBk4819_Sync();
+
+	for (i = 0; i < ARRAY_SIZE(Registers); i++)
+		if (ShadowTest(gShadowValid, Registers[i]) && gShadowValue[Registers[i]] != gMockBk4819.Reg[Registers[i]])
+			bOk = false;
+
+	Check(bOk, "random: the shadow agrees with the chip");
+	Check(gMockBk4819.Reads + gBK4819_ShadowStats.ReadsSaved == Reads, "random: reads = bus reads + saved reads");
+	Check(gMockBk4819.Writes + gBK4819_ShadowStats.WritesSaved == Writes + Updates, "random: writes = bus writes + saved writes");
+	Check(gMockBk4819.BadTransactions == 0, "random: 24 clocks in every transaction");
+}
+
+static void Tune(const uint32_t Frequency)
+{	// the register side of RADIO_SetupRegisters() for a channel
+	BK4819_BeginBatch();
+	BK4819_SetFilterBandwidth(BK4819_FILTER_BW_NARROW, false);
+	BK4819_SetupPowerAmplifier(0, Frequency);
+	BK4819_SetFrequency(Frequency);
+	BK4819_SetupSquelch(72, 70, 46, 47, 10, 8);
+	BK4819_CommitBatch();
+}
+
+static void Count(const char *pWhat, const unsigned int Times, const uint32_t Step)
+{
+	uint32_t     Frequency = 14550000;
+	unsigned int i;
+
+	Reset();
+
+	Tune(Frequency);     // the shadow starts out empty, the first one is the full cost
+	MockBk4819_Sync();
+	MockBk4819_Reset();
+	memset(&gBK4819_ShadowStats, 0, sizeof(gBK4819_ShadowStats));
+
+	for (i = 0; i < Times; i++)
+	{
+		Frequency += Step;
+		Tune(Frequency);
+	}
+	MockBk4819_Sync();
+
+	printf("%-24s %3u bus transactions, %3u saved (%u reads, %u writes)\n",
+		pWhat,
+		gMockBk4819.Reads + gMockBk4819.Writes,
+		gBK4819_ShadowStats.ReadsSaved + gBK4819_ShadowStats.WritesSaved,
+		gBK4819_ShadowStats.ReadsSaved,
+		gBK4819_ShadowStats.WritesSaved);
+}
+
+int main(void)
+{
+	TestReads();
+	TestWrites();
+	TestBatch();
+	TestRandom();
+
+	printf("\nafter a first tune\n");
+	Count("same channel x10", 10, 0);
+	Count("12.5kHz scan steps x10", 10, 1250);
+
+	if (gFailures > 0)
+	{
+		printf("%u failed\n", gFailures);
+		return EXIT_FAILURE;
+	}
+
+	printf("all passed\n");
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,186 @@
+/* Host check of the packed Chinese fonts (ENABLE_PACKED_CN_FONT), the tables create_packed_cn_fonts() in
+ * utils/main.cpp writes to font.c and the UnpackCNGlyph() decoder in ui/helper.c:
+ *
+ *   gcc -O2 -I. utils/cn_font_test.c -o cn_font_test && ./cn_font_test
+ *
+ * font.c is built twice, once packed and once with the original CNFont14/CNFont6 bitmaps (the rest
+ * of its tables renamed out of the way), and every glyph of both fonts has to unpack to exactly the
+ * original bytes, the dropped rows included.
+ *
+ * Last it times one glyph drawn both ways, UnpackCNGlyph() against the memmove() it replaces. That's
+ * host time, it shows how the two compare, not what they take on the Cortex-M0.
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define ENABLE_PACKED_CN_FONT
+#include "font.c"
+#include "ui/helper.c"
+#undef  ENABLE_PACKED_CN_FONT
+
+// ui/helper.c brought in external/printf/printf.h, the test prints with the host's
+#undef  printf
+#undef  sprintf
+#undef  vsprintf
+
+// the original bitmaps, everything else in font.c a second time under other names
+#define CNList             Unpacked_CNList
+#define CNIndex            Unpacked_CNIndex
+#define CNIndexCount       Unpacked_CNIndexCount
+#define gFontBig           Unpacked_gFontBig
+#define gFontBigDigits     Unpacked_gFontBigDigits
+#define gFontSmallDigits   Unpacked_gFontSmallDigits
+#define gFontSmall         Unpacked_gFontSmall
+#define gFontSmallBold     Unpacked_gFontSmallBold
+#define gFont3x5           Unpacked_gFont3x5
+#include "font.c"
+#undef  CNList
+#undef  CNIndex
+#undef  CNIndexCount
+
+// the rest of the firmware as far as ui/helper.c sees it
+uint8_t  gFrameBuffer[7][128];
+uint16_t gEepromWriteCount;
+char     gInputBox[8];
+uint8_t  gInputBoxIndex;
+
+void BOARD_fetchChannelName(char *s, const int channel)
+{
+	(void)channel;
+	s[0] = 0;
+}
+
+int sprintf_(char *buffer, const char *format, ...)
+{
+	va_list va;
+	int     n;
+
+	va_start(va, format);
+	n = vsprintf(buffer, format, va);
+	va_end(va);
+	return n;
+}
+
+#define CN_GLYPHS  (sizeof(CNFont14) / sizeof(CNFont14[0]))
+
+static unsigned int gFailures;
+
+static void Check(const bool bOk, const char *pWhat)
+{
+	printf("%-52s %s\n", pWhat, bOk ? "ok" : "FAIL");
+	if (!bOk)
+		gFailures++;
+}
+
+static void TestGlyphs(void)
+{
+	unsigned int Glyph;
+	unsigned int Bad14 = 0;
+	unsigned int Bad6  = 0;
+
+	for (Glyph = 0; Glyph < CN_GLYPHS; Glyph++)
+	{
+		uint8_t Line[2][14];
+		uint8_t Small[6];
+
+		UnpackCNGlyph(CNFont14Packed, Glyph, 14, 14, Line[0], Line[1]);
+		if (memcmp(Line[0], &CNFont14[Glyph][0], 14) != 0 || memcmp(Line[1], &CNFont14[Glyph][14], 14) != 0)
+			Bad14++;
+
+		UnpackCNGlyph(CNFont6Packed, Glyph, 6, 6, Small, NULL);
+		if (memcmp(Small, CNFont6[Glyph], 6) != 0)
+			Bad6++;
+	}
+
+	Check(CN_GLYPHS == CNIndexCount, "one glyph for each CNIndex entry");
+	Check(CN_GLYPHS == sizeof(CNFont6) / sizeof(CNFont6[0]), "both fonts have the same glyphs");
+	Check(sizeof(CNFont14Packed) == (CN_GLYPHS * 14 * 14 + 7) / 8, "CNFont14Packed is 14 x 14 bits a glyph");
+	Check(sizeof(CNFont6Packed) == (CN_GLYPHS * 6 * 6 + 7) / 8, "CNFont6Packed is 6 x 6 bits a glyph");
+	Check(Bad14 == 0, "CNFont14: every glyph unpacks to the original");
+	Check(Bad6 == 0, "CNFont6: every glyph unpacks to the original");
+
+	printf("%u glyphs, %zu + %zu bytes packed, %zu + %zu unpacked\n",
+		(unsigned int)CN_GLYPHS, sizeof(CNFont14Packed), sizeof(CNFont6Packed), sizeof(CNFont14), sizeof(CNFont6));
+}
+
+static double Now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + (ts.tv_nsec * 1e-9);
+}
+
+#define CALLS  (CN_GLYPHS * 100)
+
+static double TimeGlyphs(const bool bPacked, const bool bBig)
+{	// best of a few runs, ns a glyph
+	double       Best = 1e9;
+	unsigned int Run;
+
+	for (Run = 0; Run < 50; Run++)
+	{
+		const double Start = Now();
+		unsigned int i;
+
+		for (i = 0; i < CALLS; i++)
+		{
+			const unsigned int Glyph = i % CN_GLYPHS;
+
+			if (bBig)
+			{
+				if (bPacked)
+					UnpackCNGlyph(CNFont14Packed, Glyph, 14, 14, gFrameBuffer[0], gFrameBuffer[1]);
+				else
+				{
+					memmove(gFrameBuffer[0], &CNFont14[Glyph][0], 14);
+					memmove(gFrameBuffer[1], &CNFont14[Glyph][14], 14);
+				}
+			}
+			else
+			{
+				if (bPacked)
+					UnpackCNGlyph(CNFont6Packed, Glyph, 6, 6, gFrameBuffer[0], NULL);
+				else
+					memmove(gFrameBuffer[0], CNFont6[Glyph], 6);
+			}
+
+			__asm volatile ("" : : "r" (gFrameBuffer) : "memory");   // keep every glyph's stores
+		}
+
+		{
+			const double ns = ((Now() - Start) * 1e9) / CALLS;
+			if (Best > ns)
+				Best = ns;
+		}
+	}
+
+	return Best;
+}
+
+static void Benchmark(void)
+{
+	printf("\nhost ns a glyph        memmove   unpack\n");
+	printf("CNFont14 (14 x 14)     %7.1f  %7.1f\n", TimeGlyphs(false, true), TimeGlyphs(true, true));
+	printf("CNFont6  (6 x 6)       %7.1f  %7.1f\n", TimeGlyphs(false, false), TimeGlyphs(true, false));
+}
+
+int main(void)
+{
+	TestGlyphs();
+	Benchmark();
+
+	if (gFailures > 0)
+	{
+		printf("%u failed\n", gFailures);
+		return EXIT_FAILURE;
+	}
+
+	printf("all passed\n");
+	return EXIT_SUCCESS;
+}
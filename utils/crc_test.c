@@ -0,0 +1,143 @@
+/* Host check of the ENABLE_CRC_SOFTWARE path in driver/crc.c, the slice-by-4 tables against a plain
+ * bit at a time CRC-16/XMODEM:
+ *
+ *   gcc -O2 -I. utils/crc_test.c -o crc_test && ./crc_test
+ *
+ * Every length from 0 to 300 bytes is checked from each of the four alignments, in one piece and split
+ * at a spread of points, and in pieces of 1 to 7 bytes, so the CRC carries across the 4-byte loop and
+ * the byte loop both ways. The peripheral path can't be run on the host.
+ */
+
+#define ENABLE_CRC_SOFTWARE
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "driver/crc.c"
+#include "misc.h"
+
+#define MAX_LENGTH  300u
+
+static unsigned int gFailures;
+
+static void Check(const bool bOk, const char *pWhat)
+{
+	printf("%-52s %s\n", pWhat, bOk ? "ok" : "FAIL");
+	if (!bOk)
+		gFailures++;
+}
+
+static uint16_t Reference(const uint8_t *pData, unsigned int Size)
+{	// CRC-16/XMODEM one bit at a time, polynomial 0x1021, zero seed
+	uint16_t     Crc = 0;
+	unsigned int n;
+
+	for (; Size > 0; Size--)
+	{
+		Crc ^= (uint16_t)(*pData++ << 8);
+		for (n = 0; n < 8; n++)
+			Crc = (Crc << 1) ^ ((Crc & 0x8000U) ? 0x1021U : 0U);
+	}
+
+	return Crc;
+}
+
+static uint16_t Pieces(const uint8_t *pData, const unsigned int Size, const unsigned int *pSplits, const unsigned int Splits)
+{	// fed in pieces ending at each split point, then the rest
+	CRC_Context_t Context;
+	unsigned int  Done = 0;
+	unsigned int  i;
+
+	CRC_Begin(&Context);
+
+	for (i = 0; i < Splits; i++)
+	{
+		if (pSplits[i] < Done || pSplits[i] > Size)
+			continue;
+		CRC_Update(&Context, pData + Done, pSplits[i] - Done);
+		Done = pSplits[i];
+	}
+
+	CRC_Update(&Context, pData + Done, Size - Done);
+
+	return CRC_End(&Context);
+}
+
+int main(void)
+{
+	static const unsigned int Splits[] = { 0, 1, 2, 3, 4, 5, 7, 8, 13, 16, 31, 64, 65, 127, 128, 200, 255, 256, 299, 300 };
+
+	static uint8_t Buffer[MAX_LENGTH + 4];
+	uint32_t       Seed         = 1;
+	unsigned int   Whole        = 0;
+	unsigned int   SplitOnce    = 0;
+	unsigned int   SplitPieces  = 0;
+	unsigned int   Small        = 0;
+	unsigned int   Offset;
+	unsigned int   Length;
+	unsigned int   i;
+
+	CRC_Init();
+
+	for (i = 0; i < sizeof(Buffer); i++)
+	{
+		Seed      = (Seed * 1103515245u) + 12345u;
+		Buffer[i] = (uint8_t)(Seed >> 16);
+	}
+
+	Check(CRC_Calculate("123456789", 9) == 0x31C3, "the CRC-16/XMODEM check value, 0x31C3");
+	Check(CRC_Calculate(Buffer, 0) == 0, "no data is a zero CRC");
+
+	for (Offset = 0; Offset < 4; Offset++)
+	{
+		const uint8_t *pData = Buffer + Offset;
+
+		for (Length = 0; Length <= MAX_LENGTH; Length++)
+		{
+			const uint16_t Expected = Reference(pData, Length);
+
+			if (CRC_Calculate(pData, Length) != Expected)
+				Whole++;
+
+			for (i = 0; i < ARRAY_SIZE(Splits); i++)
+				if (Pieces(pData, Length, &Splits[i], 1) != Expected)
+					SplitOnce++;
+
+			if (Pieces(pData, Length, Splits, ARRAY_SIZE(Splits)) != Expected)
+				SplitPieces++;
+
+			{	// pieces of 1 to 7 bytes
+				CRC_Context_t Context;
+				unsigned int  Done = 0;
+				unsigned int  Size = 1;
+
+				CRC_Begin(&Context);
+				while (Done < Length)
+				{
+					const unsigned int Piece = (Length - Done < Size) ? Length - Done : Size;
+
+					CRC_Update(&Context, pData + Done, Piece);
+					Done += Piece;
+					Size  = (Size % 7) + 1;
+				}
+
+				if (CRC_End(&Context) != Expected)
+					Small++;
+			}
+		}
+	}
+
+	Check(Whole == 0, "lengths 0..300, 4 alignments, in one piece");
+	Check(SplitOnce == 0, "split in two at each of the split points");
+	Check(SplitPieces == 0, "split at all the split points at once");
+	Check(Small == 0, "in pieces of 1 to 7 bytes");
+
+	if (gFailures > 0)
+	{
+		printf("%u failed\n", gFailures);
+		return EXIT_FAILURE;
+	}
+
+	printf("all passed\n");
+	return EXIT_SUCCESS;
+}
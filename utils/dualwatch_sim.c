@@ -0,0 +1,276 @@
+/* Host simulation of the ENABLE_ADAPTIVE_DUAL_WATCH policy (app/dualwatch.c)
+ * against synthetic Poisson traffic on the two VFO's, fixed timing vs adaptive.
+ *
+ *   gcc -O2 -I. utils/dualwatch_sim.c -lm -o dualwatch_sim && ./dualwatch_sim
+ *
+ * One step is one 10ms systick. A call is heard if the radio is listening on its
+ * VFO at any point while it is on the air (the squelch is taken to open within the
+ * tick), after a call the radio holds on that VFO for dual_watch_count_after_rx_10ms.
+ *
+ * The power save run models the app.c cycle with a 1:4 battery save: sleep, wake on one
+ * VFO for power_save1_10ms, toggle to the other for power_save1_10ms, sleep again, and
+ * stay awake for battery_save_count_10ms after a call.
+ */
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+const uint16_t dual_watch_count_toggle_10ms   = 100 / 10;
+const uint16_t dual_watch_count_after_rx_10ms = 1000 / 10;
+
+#include "app/dualwatch.c"
+
+#define SIM_TICKS            (10u * 3600u * 100u)   // 10 hours
+#define SIM_MAX_CALLS        40000
+#define POWER_SAVE1_10MS     (100 / 10)
+#define BATTERY_SAVE_10MS    (4 * 10)                // 1:4
+#define BATTERY_COUNT_10MS   (10000 / 10)
+
+typedef struct {
+	uint32_t Start;
+	uint32_t End;
+	bool     bHeard;
+} Call_t;
+
+typedef struct {
+	const char *pName;
+	double      Gap_s[2];      // mean time between calls
+	double      MinLen_s[2];
+	double      MaxLen_s[2];
+} Scenario_t;
+
+typedef struct {
+	unsigned int Missed[2];
+	unsigned int Calls[2];
+	unsigned long Retunes;     // VFO toggles
+	unsigned long Wakeups;     // power save only
+	unsigned long AwakeTicks;
+} Result_t;
+
+static Call_t       gCalls[2][SIM_MAX_CALLS];
+static unsigned int gCallCount[2];
+static unsigned int gCallIndex[2];
+
+static double Random(void)
+{
+	return (rand() + 1.0) / (RAND_MAX + 2.0);
+}
+
+static void GenerateCalls(const Scenario_t *pScenario)
+{
+	unsigned int v;
+
+	for (v = 0; v < 2; v++)
+	{
+		double t = 0;
+
+		gCallCount[v] = 0;
+		while (gCallCount[v] < SIM_MAX_CALLS)
+		{
+			const double Len = (pScenario->MinLen_s[v] + (pScenario->MaxLen_s[v] - pScenario->MinLen_s[v]) * Random()) * 100;
+
+			t += -log(Random()) * pScenario->Gap_s[v] * 100;
+			if (t + Len >= SIM_TICKS)
+				break;
+
+			gCalls[v][gCallCount[v]].Start  = t;
+			gCalls[v][gCallCount[v]].End    = t + Len;
+			gCallCount[v]++;
+			t += Len;
+		}
+	}
+}
+
+static void ResetRun(void)
+{
+	unsigned int v, i;
+
+	for (v = 0; v < 2; v++)
+	{
+		gCallIndex[v] = 0;
+		for (i = 0; i < gCallCount[v]; i++)
+			gCalls[v][i].bHeard = false;
+	}
+
+	memset(gActivity, 0, sizeof(gActivity));
+}
+
+// the call on the air on Vfo at Tick, or -1
+static int OnAir(const unsigned int Vfo, const uint32_t Tick)
+{
+	while (gCallIndex[Vfo] < gCallCount[Vfo] && gCalls[Vfo][gCallIndex[Vfo]].End <= Tick)
+		gCallIndex[Vfo]++;
+
+	if (gCallIndex[Vfo] < gCallCount[Vfo] && gCalls[Vfo][gCallIndex[Vfo]].Start <= Tick)
+		return gCallIndex[Vfo];
+
+	return -1;
+}
+
+static void Tally(Result_t *pResult)
+{
+	unsigned int v, i;
+
+	for (v = 0; v < 2; v++)
+	{
+		pResult->Calls[v] = gCallCount[v];
+		for (i = 0; i < gCallCount[v]; i++)
+			if (!gCalls[v][i].bHeard)
+				pResult->Missed[v]++;
+	}
+}
+
+static Result_t Run(const bool bAdaptive, const bool bPowerSave)
+{
+	Result_t     Result    = {0};
+	unsigned int Vfo       = 0;
+	int          Rx        = -1;
+	uint32_t     Countdown = dual_watch_count_toggle_10ms;
+	uint32_t     Hold      = 0;
+	uint32_t     Battery   = BATTERY_COUNT_10MS;
+	bool         bSleeping = false;
+	unsigned int Visits    = 0;    // VFO's listened to since the last wake up
+	uint32_t     Tick;
+
+	ResetRun();
+
+	for (Tick = 0; Tick < SIM_TICKS; Tick++)
+	{
+		int Call;
+
+		if (bAdaptive && (Tick % 50) == 0)
+			DUALWATCH_TimeSlice500ms();
+
+		if (bSleeping)
+		{
+			if (--Countdown > 0)
+				continue;
+
+			// wake up on the other VFO
+			bSleeping = false;
+			Vfo       = !Vfo;
+			Countdown = POWER_SAVE1_10MS;
+			Visits    = 1;
+			Result.Wakeups++;
+			Result.Retunes++;
+		}
+
+		Result.AwakeTicks++;
+		Call = OnAir(Vfo, Tick);
+
+		if (Rx >= 0)
+		{
+			if (Call == Rx)
+				continue;
+
+			Rx      = -1;
+			Hold    = dual_watch_count_after_rx_10ms;
+			Battery = BATTERY_COUNT_10MS;
+		}
+
+		if (Call >= 0)
+		{	// squelch opens
+			Rx = Call;
+			gCalls[Vfo][Call].bHeard = true;
+			if (bAdaptive)
+				DUALWATCH_SquelchOpened(Vfo);
+			Visits = 0;
+			continue;
+		}
+
+		if (Hold > 0)
+		{
+			Hold--;
+			continue;
+		}
+
+		if (bPowerSave && Visits > 0)
+		{	// power save listen cycle
+			if (--Countdown > 0)
+				continue;
+
+			if (Visits < 2)
+			{
+				Vfo       = !Vfo;
+				Countdown = POWER_SAVE1_10MS;
+				Visits++;
+				Result.Retunes++;
+				continue;
+			}
+
+			bSleeping = true;
+			Countdown = bAdaptive ? DUALWATCH_PowerSaveSleep_10ms(BATTERY_SAVE_10MS) : BATTERY_SAVE_10MS;
+			continue;
+		}
+
+		if (bPowerSave && Battery > 0 && --Battery == 0)
+		{	// into power save
+			bSleeping = true;
+			Countdown = BATTERY_SAVE_10MS;
+			continue;
+		}
+
+		if (--Countdown == 0)
+		{
+			Vfo       = !Vfo;
+			Countdown = bAdaptive ? DUALWATCH_Dwell_10ms(Vfo, 0) : dual_watch_count_toggle_10ms;
+			Result.Retunes++;
+		}
+	}
+
+	Tally(&Result);
+
+	return Result;
+}
+
+static void Print(const char *pName, const Result_t *pResult, const bool bPowerSave)
+{
+	printf("  %-9s missed %4u/%-5u %4u/%-5u  retunes/h %6lu", pName,
+		pResult->Missed[0], pResult->Calls[0], pResult->Missed[1], pResult->Calls[1],
+		pResult->Retunes / 10);
+
+	if (bPowerSave)
+		printf("  wakeups/h %6lu  awake %4.1f%%", pResult->Wakeups / 10, (100.0 * pResult->AwakeTicks) / SIM_TICKS);
+
+	printf("\n");
+}
+
+int main(void)
+{
+	static const Scenario_t Scenarios[] =
+	{	// VFO A (the priority one) and B
+		{"busy A, quiet B",   { 15, 300}, {0.3,  0.3}, {4,   4}},
+		{"both busy",         { 20,  20}, {0.3,  0.3}, {4,   4}},
+		{"short bursts on A", {  5, 120}, {0.15, 0.3}, {0.4, 3}},
+		{"all quiet",         {300, 300}, {0.3,  0.3}, {4,   4}},
+	};
+	unsigned int s;
+	unsigned int p;
+
+	for (p = 0; p < 2; p++)
+	{
+		printf("%s\n", p ? "power save 1:4" : "dual watch toggling");
+
+		for (s = 0; s < sizeof(Scenarios) / sizeof(Scenarios[0]); s++)
+		{
+			Result_t Result;
+
+			srand(1234 + s);
+			GenerateCalls(&Scenarios[s]);
+
+			printf(" %s\n", Scenarios[s].pName);
+
+			Result = Run(false, p);
+			Print("fixed", &Result, p);
+
+			Result = Run(true, p);
+			Print("adaptive", &Result, p);
+		}
+	}
+
+	return 0;
+}
@@ -0,0 +1,128 @@
+/* Host test of the ENABLE_LCD_DMA display path (driver/st7565.c) against the mock registers in
+ * utils/mock_regs.h.
+ *
+ *   gcc -O2 -I. utils/lcd_dma_test.c -o lcd_dma_test && ./lcd_dma_test
+ *
+ * Each case draws into gFrameBuffer/gStatusLine, blits, lets the mock DMA run out and then checks
+ * the mock LCD RAM holds exactly what the UI drew. The busy case starts a second blit while the
+ * first one is still streaming, which has to wait for the queued lines and then take the polled path.
+ */
+
+#define ENABLE_LCD_PARTIAL_UPDATE
+#define ENABLE_LCD_DMA
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "utils/mock_regs.h"
+#include "driver/st7565.c"
+
+static unsigned int gFailures;
+
+static void Check(const bool bOk, const char *pWhat)
+{
+	printf("%-52s %s\n", pWhat, bOk ? "ok" : "FAIL");
+	if (!bOk)
+		gFailures++;
+}
+
+static bool LcdMatches(void)
+{	// the driver sends column n to LCD column n + 4
+	unsigned int Line;
+
+	if (memcmp(&gMockLcd.Ram[0][4], gStatusLine, LCD_WIDTH) != 0)
+		return false;
+
+	for (Line = 0; Line < ARRAY_SIZE(gFrameBuffer); Line++)
+		if (memcmp(&gMockLcd.Ram[Line + 1][4], gFrameBuffer[Line], LCD_WIDTH) != 0)
+			return false;
+
+	return true;
+}
+
+static void Draw(const unsigned int Seed, const unsigned int FirstLine, const unsigned int LastLine)
+{	// a pattern per line so a line that never arrives can't match by accident
+	unsigned int Line;
+	unsigned int i;
+
+	for (Line = FirstLine; Line <= LastLine; Line++)
+		for (i = 0; i < LCD_WIDTH; i++)
+			gFrameBuffer[Line][i] = (uint8_t)((Seed * 31u) + (Line * 7u) + i);
+}
+
+static void StartUp(void)
+{
+	Mock_Reset();
+	ST7565_WaitForDma();
+	memset(gStatusLine, 0, sizeof(gStatusLine));
+	memset(gFrameBuffer, 0, sizeof(gFrameBuffer));
+	ST7565_InvalidateScreen();
+}
+
+static void TestFullFrame(void)
+{
+	StartUp();
+
+	Draw(1, 0, 6);
+	ST7565_BlitFullScreen();
+	Check(ST7565_IsDmaBusy(), "full frame: blit returns while the DMA runs");
+
+	ST7565_WaitForDma();
+	Check(LcdMatches(), "full frame: LCD matches the frame buffer");
+	Check(gMockLcd.DmaBytes == 7u * LCD_WIDTH, "full frame: every data byte went by DMA");
+}
+
+static void TestBusyFallback(void)
+{
+	StartUp();
+
+	// first frame, all seven lines queued, only the first few bytes out when the next blit comes in
+	Draw(2, 0, 6);
+	ST7565_BlitFullScreen();
+	ST7565_ServiceDma();
+	Check(ST7565_IsDmaBusy(), "busy: first frame still streaming");
+
+	// second frame changes only the bottom lines, the top ones are only on their way from the first
+	Draw(3, 4, 6);
+	ST7565_BlitFullScreen();
+
+	Check(!ST7565_IsDmaBusy(), "busy: second blit took the polled path");
+	Check(gMockLcd.DmaBytes == 7u * LCD_WIDTH, "busy: first frame's queue ran out");
+	Check(LcdMatches(), "busy: LCD matches the frame buffer");
+
+	// and the next one streams again
+	Draw(4, 2, 2);
+	ST7565_BlitFullScreen();
+	ST7565_WaitForDma();
+	Check(LcdMatches(), "busy: next blit after the fallback");
+}
+
+static void TestStatusLineWhileBusy(void)
+{
+	StartUp();
+
+	Draw(5, 0, 6);
+	ST7565_BlitFullScreen();
+
+	memset(gStatusLine, 0x5A, sizeof(gStatusLine));
+	ST7565_BlitStatusLine();
+	ST7565_WaitForDma();
+
+	Check(LcdMatches(), "status line during a frame: LCD matches");
+}
+
+int main(void)
+{
+	TestFullFrame();
+	TestBusyFallback();
+	TestStatusLineWhileBusy();
+
+	if (gFailures > 0)
+	{
+		printf("%u failed\n", gFailures);
+		return EXIT_FAILURE;
+	}
+
+	printf("all passed\n");
+	return EXIT_SUCCESS;
+}
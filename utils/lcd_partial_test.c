@@ -0,0 +1,156 @@
+/* Host test of the ENABLE_LCD_PARTIAL_UPDATE display path (driver/st7565.c) against the mock registers
+ * in utils/mock_regs.h.
+ *
+ *   gcc -O2 -I. utils/lcd_partial_test.c -o lcd_partial_test && ./lcd_partial_test
+ *
+ * Each case changes part of gFrameBuffer/gStatusLine, blits, then checks the mock LCD RAM holds
+ * exactly what the UI drew and counts the data bytes that went over the SPI. BlitLine() has to send
+ * only the span from the first to the last changed column of each line, and nothing for a line that
+ * didn't change. A full blit without the shadow is 7 x 128 data bytes every time.
+ */
+
+#define ENABLE_LCD_PARTIAL_UPDATE
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "utils/mock_regs.h"
+#include "driver/st7565.c"
+
+#define FULL_FRAME_BYTES  (ARRAY_SIZE(gFrameBuffer) * LCD_WIDTH)
+
+static unsigned int gFailures;
+
+static void Check(const bool bOk, const char *pWhat)
+{
+	printf("%-58s %s\n", pWhat, bOk ? "ok" : "FAIL");
+	if (!bOk)
+		gFailures++;
+}
+
+static bool LcdMatches(void)
+{	// the driver sends column n to LCD column n + 4
+	unsigned int Line;
+
+	if (memcmp(&gMockLcd.Ram[0][4], gStatusLine, LCD_WIDTH) != 0)
+		return false;
+
+	for (Line = 0; Line < ARRAY_SIZE(gFrameBuffer); Line++)
+		if (memcmp(&gMockLcd.Ram[Line + 1][4], gFrameBuffer[Line], LCD_WIDTH) != 0)
+			return false;
+
+	return true;
+}
+
+static uint32_t Blit(void)
+{	// data bytes the blit sent
+	const uint32_t Before = gMockLcd.DataBytes;
+
+	ST7565_BlitFullScreen();
+	MockSpi_Sync();
+	return gMockLcd.DataBytes - Before;
+}
+
+static void Report(const char *pWhat, const uint32_t Bytes, const uint32_t Expected)
+{
+	char What[96];
+
+	snprintf(What, sizeof(What), "%-44s %3u bytes", pWhat, Bytes);
+	Check(Bytes == Expected && LcdMatches(), What);
+}
+
+static void StartUp(void)
+{
+	unsigned int Line;
+	unsigned int i;
+
+	Mock_Reset();
+	memset(gStatusLine, 0, sizeof(gStatusLine));
+	for (Line = 0; Line < ARRAY_SIZE(gFrameBuffer); Line++)
+		for (i = 0; i < LCD_WIDTH; i++)
+			gFrameBuffer[Line][i] = (uint8_t)((Line * 7u) + i);
+
+	ST7565_InvalidateScreen();
+}
+
+static void TestSpans(void)
+{
+	StartUp();
+
+	Report("first blit sends everything", Blit(), FULL_FRAME_BYTES);
+	Report("nothing changed", Blit(), 0);
+
+	gFrameBuffer[3][50] ^= 0x01;
+	Report("one column", Blit(), 1);
+
+	gFrameBuffer[3][10]  ^= 0x80;
+	gFrameBuffer[3][100] ^= 0x80;
+	Report("two columns, the span between them", Blit(), 91);
+
+	gFrameBuffer[2][0]   ^= 0x10;
+	gFrameBuffer[5][127] ^= 0x10;
+	Report("first and last column on two lines", Blit(), 2);
+
+	memset(&gFrameBuffer[6][20], 0xFF, 40);
+	Report("an RSSI bar grows", Blit(), 40);
+
+	memset(&gFrameBuffer[6][40], 0x00, 20);
+	Report("and shrinks", Blit(), 20);
+
+	gFrameBuffer[0][0]   ^= 0x01;
+	gFrameBuffer[0][127] ^= 0x01;
+	Report("both ends of a line", Blit(), LCD_WIDTH);
+
+	gFrameBuffer[4][64] = gFrameBuffer[4][64];
+	Report("rewritten with the same value", Blit(), 0);
+}
+
+static void TestInvalidate(void)
+{
+	static const uint8_t Bitmap[8] = { 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55 };
+
+	StartUp();
+	Blit();
+
+	// drawn straight to the LCD, behind the frame buffer's back
+	ST7565_DrawLine(30, 2, sizeof(Bitmap), Bitmap);
+	Check(!LcdMatches(), "invalidate: DrawLine puts the LCD out of step");
+	Report("invalidate: the next blit resends that line", Blit(), LCD_WIDTH);
+
+	ST7565_InvalidateScreen();
+	Report("invalidate: the whole screen", Blit(), FULL_FRAME_BYTES);
+}
+
+static void TestStatusLine(void)
+{
+	uint32_t Before;
+
+	StartUp();
+	Blit();
+	ST7565_BlitStatusLine();
+	MockSpi_Sync();
+
+	Before = gMockLcd.DataBytes;
+	gStatusLine[5] = 0x7E;
+	ST7565_BlitStatusLine();
+	MockSpi_Sync();
+	Report("status line: one column", gMockLcd.DataBytes - Before, 1);
+
+	Report("status line: a frame blit leaves it alone", Blit(), 0);
+}
+
+int main(void)
+{
+	TestSpans();
+	TestInvalidate();
+	TestStatusLine();
+
+	if (gFailures > 0)
+	{
+		printf("%u failed\n", gFailures);
+		return EXIT_FAILURE;
+	}
+
+	printf("all passed, a full blit would be %u bytes each time\n", (unsigned int)FULL_FRAME_BYTES);
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,680 @@
+/* Host display simulator: the UI code (the ui/ sources, font.c, bitmaps.c) drawing through the real ST7565
+ * driver into a mock LCD, see utils/lcd_sim/st7565.c. Built and run by "make lcd-sim".
+ *
+ *   lcd_sim [-u] <golden dir> <output dir>
+ *   lcd_sim -b
+ *
+ * Every scenario sets up some radio state, draws one of the screens GUI_DisplayScreen knows plus the
+ * status line, and writes what the LCD shows to <output dir>/<name>.pbm and .png. The images and the
+ * blit/SPI byte counts are compared against <golden dir>, -u writes the goldens instead. The scenarios
+ * run in order on the same LCD, so the byte counts are what the partial update sends for each step,
+ * not a full repaint. The goldens are for the Makefile's default ENABLE_ options.
+ *
+ * -b times UI_DisplayMain instead (host nanoseconds per call, blit included) for a few kinds of update,
+ * run it with ENABLE_MAIN_WIDGETS=0 and =1 to see what the widget cache saves.
+ */
+
+#define _POSIX_C_SOURCE 199309L   // clock_gettime() under -std=c11
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#ifdef ENABLE_FMRADIO
+	#include "app/fm.h"
+#endif
+#include "app/scanner.h"
+#include "driver/st7565.h"
+#include "functions.h"
+#include "helper/battery.h"
+#include "misc.h"
+#include "radio.h"
+#include "settings.h"
+#include "ui/inputbox.h"
+#include "ui/main.h"
+#include "ui/menu.h"
+#include "ui/status.h"
+#include "ui/ui.h"
+#include "ui/welcome.h"
+#include "utils/lcd_sim/st7565.h"
+#include "utils/lcd_sim/stubs.h"
+
+typedef struct {
+	const char *pName;
+	void      (*Setup)(void);
+	void      (*Draw)(void);
+} Scenario_t;
+
+static const char *gGoldenDir;
+static const char *gOutputDir;
+static bool        gUpdate;
+static unsigned int gFailures;
+
+// ************ image output
+
+static uint32_t Crc32(uint32_t Crc, const uint8_t *pData, const size_t Size)
+{
+	size_t i;
+
+	Crc = ~Crc;
+	for (i = 0; i < Size; i++)
+	{
+		unsigned int k;
+
+		Crc ^= pData[i];
+		for (k = 0; k < 8; k++)
+			Crc = (Crc >> 1) ^ (0xEDB88320u & (0u - (Crc & 1u)));
+	}
+	return ~Crc;
+}
+
+static void PutBE32(uint8_t *p, const uint32_t Value)
+{
+	p[0] = Value >> 24;
+	p[1] = Value >> 16;
+	p[2] = Value >>  8;
+	p[3] = Value >>  0;
+}
+
+static void WriteChunk(FILE *fp, const char *pType, const uint8_t *pData, const uint32_t Size)
+{
+	uint8_t  Header[8];
+	uint8_t  Trailer[4];
+	uint32_t Crc;
+
+	PutBE32(Header, Size);
+	memmove(Header + 4, pType, 4);
+	Crc = Crc32(0, Header + 4, 4);
+	Crc = Crc32(Crc, pData, Size);
+	PutBE32(Trailer, Crc);
+
+	fwrite(Header, 1, sizeof(Header), fp);
+	fwrite(pData, 1, Size, fp);
+	fwrite(Trailer, 1, sizeof(Trailer), fp);
+}
+
+// one byte per row for the filter type, then 1 bit per pixel
+#define PNG_ROW_SIZE    (1 + (LCD_WIDTH / 8))
+#define PNG_RAW_SIZE    (PNG_ROW_SIZE * LCD_HEIGHT)
+
+static void WritePng(const char *pPath, const uint8_t *pPixels)
+{	// 1 bit greyscale, the image data is a single stored (uncompressed) deflate block so no zlib is needed
+	static const uint8_t Signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+	uint8_t  Header[13];
+	uint8_t  Data[2 + 5 + PNG_RAW_SIZE + 4];
+	uint8_t *pRaw = Data + 2 + 5;
+	uint32_t a = 1;
+	uint32_t b = 0;
+	unsigned int y;
+	unsigned int i;
+	FILE    *fp;
+
+	PutBE32(Header + 0, LCD_WIDTH);
+	PutBE32(Header + 4, LCD_HEIGHT);
+	Header[8]  = 1;   // bit depth
+	Header[9]  = 0;   // greyscale
+	Header[10] = 0;
+	Header[11] = 0;
+	Header[12] = 0;
+
+	for (y = 0; y < LCD_HEIGHT; y++)
+	{	// PBM has 1 = black, PNG greyscale has 1 = white
+		pRaw[y * PNG_ROW_SIZE] = 0;
+		for (i = 0; i < LCD_WIDTH / 8; i++)
+			pRaw[(y * PNG_ROW_SIZE) + 1 + i] = ~pPixels[(y * (LCD_WIDTH / 8)) + i];
+	}
+
+	for (i = 0; i < PNG_RAW_SIZE; i++)
+	{
+		a = (a + pRaw[i]) % 65521u;
+		b = (b + a) % 65521u;
+	}
+
+	Data[0] = 0x78;   // zlib header, 32K window, no compression
+	Data[1] = 0x01;
+	Data[2] = 0x01;   // final block, stored
+	Data[3] = PNG_RAW_SIZE & 0xFF;
+	Data[4] = PNG_RAW_SIZE >> 8;
+	Data[5] = ~PNG_RAW_SIZE & 0xFF;
+	Data[6] = (~PNG_RAW_SIZE >> 8) & 0xFF;
+	PutBE32(pRaw + PNG_RAW_SIZE, (b << 16) | a);
+
+	fp = fopen(pPath, "wb");
+	if (fp == NULL)
+	{
+		perror(pPath);
+		exit(EXIT_FAILURE);
+	}
+
+	fwrite(Signature, 1, sizeof(Signature), fp);
+	WriteChunk(fp, "IHDR", Header, sizeof(Header));
+	WriteChunk(fp, "IDAT", Data, sizeof(Data));
+	WriteChunk(fp, "IEND", NULL, 0);
+	fclose(fp);
+}
+
+static void WriteFile(const char *pPath, const void *pData, const size_t Size)
+{
+	FILE *fp = fopen(pPath, "wb");
+
+	if (fp == NULL || fwrite(pData, 1, Size, fp) != Size)
+	{
+		perror(pPath);
+		exit(EXIT_FAILURE);
+	}
+	fclose(fp);
+}
+
+static bool ReadFile(const char *pPath, void *pData, const size_t Size)
+{
+	FILE  *fp = fopen(pPath, "rb");
+	size_t Read;
+
+	if (fp == NULL)
+		return false;
+	Read = fread(pData, 1, Size, fp);
+	fclose(fp);
+	return Read == Size;
+}
+
+// ************ scenarios
+
+static void SetupVfo(const unsigned int Vfo, const uint8_t Channel, const uint32_t Frequency, const ModulationMode_t Modulation)
+{
+	VFO_Info_t *pInfo = &gEeprom.VfoInfo[Vfo];
+
+	memset(pInfo, 0, sizeof(*pInfo));
+	pInfo->freq_config_RX.Frequency = Frequency;
+	pInfo->freq_config_TX.Frequency = Frequency;
+	pInfo->pRX                      = &pInfo->freq_config_RX;
+	pInfo->pTX                      = &pInfo->freq_config_TX;
+	pInfo->CHANNEL_SAVE             = Channel;
+	pInfo->Modulation               = Modulation;
+	pInfo->OUTPUT_POWER             = OUTPUT_POWER_HIGH;
+
+	gEeprom.ScreenChannel[Vfo] = Channel;
+	if (IS_MR_CHANNEL(Channel))
+		gEeprom.MrChannel[Vfo] = Channel;
+	else
+		gEeprom.FreqChannel[Vfo] = Channel;
+}
+
+static void ProgramChannel(const uint8_t Channel, const uint32_t Frequency, const char *pName, const uint8_t Attributes)
+{
+	memmove(&gSimEeprom[Channel * 16], &Frequency, sizeof(Frequency));
+	memset(&gSimEeprom[0x0F50 + (Channel * 16)], 0, 16);
+	memmove(&gSimEeprom[0x0F50 + (Channel * 16)], pName, strlen(pName));
+	gMR_ChannelAttributes[Channel] = Attributes;
+}
+
+static void Sim_Init(void)
+{
+	memset(gSimEeprom, 0xFF, sizeof(gSimEeprom));
+	memset(gMR_ChannelAttributes, 0xFF, sizeof(gMR_ChannelAttributes));
+
+	memset(&gSimEeprom[0x0EB0], 0, 32);
+	memmove(&gSimEeprom[0x0EB0], "HELLO", 5);
+	memmove(&gSimEeprom[0x0EC0], "UV-K5", 5);
+
+	ProgramChannel(0, 14550000, "CALLING",   BAND3_137MHz | MR_CH_SCANLIST1);
+	ProgramChannel(1, 43350000, "LPD 1",     BAND6_400MHz | MR_CH_SCANLIST1 | MR_CH_SCANLIST2);
+	ProgramChannel(2, 44600625, "PMR 1",     BAND6_400MHz);
+
+	gBatteryCalibration[0]        = 650;
+	gBatteryCalibration[5]        = 840;
+	gBatteryVoltageAverage        = 790;
+	gBatteryDisplayLevel          = 5;
+
+	gEeprom.POWER_ON_DISPLAY_MODE = POWER_ON_DISPLAY_MODE_MESSAGE;
+	gEeprom.CHANNEL_DISPLAY_MODE  = MDF_NAME_FREQ;
+	gEeprom.TX_VFO                = 0;
+	gEeprom.RX_VFO                = 0;
+	gEeprom.DUAL_WATCH            = DUAL_WATCH_OFF;
+
+	SetupVfo(0, FREQ_CHANNEL_FIRST + BAND3_137MHz, 14552500, MODULATION_FM);
+	SetupVfo(1, FREQ_CHANNEL_FIRST + BAND6_400MHz, 43392500, MODULATION_FM);
+	gTxVfo      = &gEeprom.VfoInfo[0];
+	gRxVfo      = &gEeprom.VfoInfo[0];
+	gCurrentVfo = &gEeprom.VfoInfo[0];
+
+	gCurrentFunction = FUNCTION_FOREGROUND;
+	gScreenToDisplay = DISPLAY_MAIN;
+
+	// count the menu items like main() does
+	gMenuListCount = 0;
+	while (MenuList[gMenuListCount].name[0] != '\0' && MenuList[gMenuListCount].menu_id != FIRST_HIDDEN_MENU_ITEM)
+		gMenuListCount++;
+}
+
+static void SelectMenu(const uint8_t MenuId)
+{
+	for (gMenuCursor = 0; gMenuCursor < gMenuListCount; gMenuCursor++)
+		if (MenuList[gMenuCursor].menu_id == MenuId)
+			return;
+
+	fprintf(stderr, "menu item %u not in the list\n", MenuId);
+	exit(EXIT_FAILURE);
+}
+
+static void Draw(void)
+{
+	GUI_DisplayScreen();
+	UI_DisplayStatus();
+}
+
+static void SetupNothing(void)
+{
+}
+
+static void SetupMainVfo(void)
+{
+	gScreenToDisplay = DISPLAY_MAIN;
+}
+
+static void SetupMainChannel(void)
+{
+	SetupVfo(0, 1, 43350000, MODULATION_FM);
+	gEeprom.VfoInfo[0].freq_config_RX.CodeType = CODE_TYPE_CONTINUOUS_TONE;
+	gEeprom.VfoInfo[0].CHANNEL_BANDWIDTH       = BANDWIDTH_NARROW;
+}
+
+static void SetupMainReceive(void)
+{
+	gCurrentFunction  = FUNCTION_RECEIVE;
+	gCurrentRSSI[0]   = (-73 + 160) * 2;   // S9
+	gRxVfoIsActive    = true;
+}
+
+static void SetupMainTransmit(void)
+{
+	gCurrentFunction   = FUNCTION_TRANSMIT;
+	gSetting_mic_bar   = true;
+	gSimVoiceAmplitude = 6000;
+	gRxVfoIsActive     = false;
+}
+
+static void SetupMainDualWatch(void)
+{
+	gCurrentFunction   = FUNCTION_FOREGROUND;
+	gEeprom.DUAL_WATCH = DUAL_WATCH_CHAN_A;
+	gDualWatchActive   = true;
+	gEeprom.KEY_LOCK   = true;
+	SetupVfo(1, 2, 44600625, MODULATION_AM);
+}
+
+static void SetupMenuSquelch(void)
+{
+	gScreenToDisplay  = DISPLAY_MENU;
+	SelectMenu(MENU_SQL);
+	gSubMenuSelection = 3;
+	gIsInSubMenu      = false;
+}
+
+static void SetupMenuSquelchEdit(void)
+{
+	gIsInSubMenu      = true;
+	gSubMenuSelection = 5;
+}
+
+static void SetupMenuMemName(void)
+{
+	SelectMenu(MENU_MEM_NAME);
+	gSubMenuSelection = 1;
+	gIsInSubMenu      = false;
+}
+
+#ifdef ENABLE_FMRADIO
+	static void SetupFm(void)
+	{
+		gScreenToDisplay           = DISPLAY_FM;
+		gIsInSubMenu               = false;
+		gEeprom.FM_IsMrMode        = false;
+		gEeprom.FM_FrequencyPlaying = 968;
+		gFM_Channels[2]            = 968;
+		gFM_ScanState              = FM_SCAN_OFF;
+	}
+#endif
+
+static void SetupScannerSearching(void)
+{
+	gScreenToDisplay       = DISPLAY_SCANNER;
+	gScanSingleFrequency   = false;
+	gScanCssState          = SCAN_CSS_STATE_OFF;
+	gScannerSaveState      = SCAN_SAVE_NO_PROMPT;
+	gScanProgressIndicator = 3;
+}
+
+static void SetupScannerFound(void)
+{
+	gScanCssState       = SCAN_CSS_STATE_FOUND;
+	gScanFrequency      = 14550000;
+	gScanCssResultType  = CODE_TYPE_CONTINUOUS_TONE;
+	gScanCssResultCode  = 8;
+	gScanUseCssResult   = true;
+}
+
+static void SetupMainAfterScanner(void)
+{	// everything the main screen had on the LCD has been drawn over
+	gScreenToDisplay = DISPLAY_MAIN;
+	gCurrentFunction = FUNCTION_FOREGROUND;
+	gDualWatchActive = false;
+}
+
+static void SetupMainVfoBTuned(void)
+{	// only VFO B's lines change
+	gEeprom.VfoInfo[1].freq_config_RX.Frequency = 44609375;
+	gEeprom.VfoInfo[1].freq_config_TX.Frequency = 44609375;
+}
+
+static void SetupMainTyping(void)
+{	// a frequency being typed in on VFO A leaves VFO B blank
+	SetupVfo(0, FREQ_CHANNEL_FIRST + BAND6_400MHz, 43392500, MODULATION_FM);
+	memset(gInputBox, 10, sizeof(gInputBox));   // 10 shows as '-'
+	gInputBoxIndex = 4;
+	gInputBox[0]   = 4;
+	gInputBox[1]   = 3;
+	gInputBox[2]   = 3;
+	gInputBox[3]   = 7;
+}
+
+static void SetupMainTyped(void)
+{
+	gInputBoxIndex = 0;
+	memset(gInputBox, 10, sizeof(gInputBox));
+	gEeprom.VfoInfo[0].freq_config_RX.Frequency = 43370000;
+	gEeprom.VfoInfo[0].freq_config_TX.Frequency = 43370000;
+}
+
+static void SetupMainRssi(void)
+{	// only the middle line changes
+	gCurrentFunction = FUNCTION_RECEIVE;
+	gCurrentRSSI[0]  = (-101 + 160) * 2;   // S5
+	gRxVfoIsActive   = true;
+}
+
+static const Scenario_t Scenarios[] =
+{
+	{ "welcome",              SetupNothing,          UI_DisplayWelcome },
+	{ "main_vfo",             SetupMainVfo,          Draw },
+	{ "main_vfo_again",       SetupNothing,          Draw },
+	{ "main_channel",         SetupMainChannel,      Draw },
+	{ "main_receive",         SetupMainReceive,      Draw },
+	{ "main_transmit",        SetupMainTransmit,     Draw },
+	{ "main_dual_watch",      SetupMainDualWatch,    Draw },
+	{ "menu_squelch",         SetupMenuSquelch,      Draw },
+	{ "menu_squelch_edit",    SetupMenuSquelchEdit,  Draw },
+	{ "menu_mem_name",        SetupMenuMemName,      Draw },
+#ifdef ENABLE_FMRADIO
+	{ "fm",                   SetupFm,               Draw },
+#endif
+	{ "scanner_searching",    SetupScannerSearching, Draw },
+	{ "scanner_found",        SetupScannerFound,     Draw },
+	{ "main_after_scanner",   SetupMainAfterScanner, Draw },
+	{ "main_vfo_b_tuned",     SetupMainVfoBTuned,    Draw },
+	{ "main_typing",          SetupMainTyping,       Draw },
+	{ "main_typed",           SetupMainTyped,        Draw },
+	{ "main_rssi",            SetupMainRssi,         Draw },
+};
+
+// ************ UI_DisplayMain benchmark
+
+static unsigned int gBenchCall;
+
+static void BenchNothing(void)
+{
+}
+
+static void BenchRssi(void)
+{	// receiving, the signal level moves
+	gCurrentRSSI[0] = (-101 + 160 + (gBenchCall % 16)) * 2;
+}
+
+static void BenchVfoB(void)
+{	// VFO B being tuned
+	const uint32_t Frequency = 43392500 + ((gBenchCall % 16) * 1250);
+
+	gEeprom.VfoInfo[1].freq_config_RX.Frequency = Frequency;
+	gEeprom.VfoInfo[1].freq_config_TX.Frequency = Frequency;
+}
+
+static void BenchDrawnOver(void)
+{	// another screen used the frame buffer in between, so everything has to be drawn again
+	memset(gFrameBuffer, 0xFF, sizeof(gFrameBuffer));
+}
+
+static double TimeCalls(void (*Change)(void), void (*Call)(void))
+{	// nanoseconds per call, the best of a few runs as the host has other things to do
+	const unsigned int Calls = 1000;
+	double             Best  = 0;
+	unsigned int       Run;
+
+	for (Run = 0; Run < 100; Run++)
+	{
+		struct timespec Start;
+		struct timespec End;
+		double          ns;
+
+		clock_gettime(CLOCK_MONOTONIC, &Start);
+		for (gBenchCall = 0; gBenchCall < Calls; gBenchCall++)
+		{
+			Change();
+			Call();
+		}
+		clock_gettime(CLOCK_MONOTONIC, &End);
+
+		ns = (((End.tv_sec - Start.tv_sec) * 1e9) + (End.tv_nsec - Start.tv_nsec)) / Calls;
+		if (Run == 0 || ns < Best)
+			Best = ns;
+	}
+
+	return Best;
+}
+
+static void Benchmark(void)
+{
+	static const struct {
+		const char *pName;
+		bool        bReceiving;
+		void      (*Change)(void);
+	} Cases[] =
+	{
+		{ "unchanged",   false, BenchNothing   },
+		{ "rssi",        true,  BenchRssi      },
+		{ "vfo_b_tuned", false, BenchVfoB      },
+		{ "drawn_over",  false, BenchDrawnOver },
+	};
+	unsigned int i;
+
+	Sim_Init();
+	LCD_SIM_Reset();
+	SetupMainChannel();
+
+#ifdef ENABLE_MAIN_WIDGETS
+	printf("UI_DisplayMain with ENABLE_MAIN_WIDGETS\n");
+#else
+	printf("UI_DisplayMain without ENABLE_MAIN_WIDGETS\n");
+#endif
+
+	for (i = 0; i < sizeof(Cases) / sizeof(Cases[0]); i++)
+	{
+		gCurrentFunction = Cases[i].bReceiving ? FUNCTION_RECEIVE : FUNCTION_FOREGROUND;
+		gRxVfoIsActive   = Cases[i].bReceiving;
+		UI_DisplayMain();
+
+		printf("%-12s %6.0f ns per call\n", Cases[i].pName, TimeCalls(Cases[i].Change, UI_DisplayMain));
+	}
+
+	// the mock SPI makes the blit dear on the host, this is the part of each call above that's only blit
+	printf("%-12s %6.0f ns per call, ST7565_BlitFullScreen() alone with nothing to send\n", "blit", TimeCalls(BenchNothing, ST7565_BlitFullScreen));
+}
+
+// ************
+
+static void RunScenario(const Scenario_t *pScenario, FILE *fpCounts)
+{
+	uint8_t            Pixels[LCD_HEIGHT][LCD_WIDTH / 8];
+	uint8_t            Golden[sizeof(Pixels)];
+	char               Header[32];
+	char               Path[512];
+	LCD_SIM_Counters_t Counters;
+	unsigned int       x;
+	unsigned int       y;
+	const int          HeaderSize = sprintf(Header, "P4\n%u %u\n", LCD_WIDTH, LCD_HEIGHT);
+
+	LCD_SIM_ClearCounters();
+	pScenario->Setup();
+	pScenario->Draw();
+	LCD_SIM_GetCounters(&Counters);
+
+	memset(Pixels, 0, sizeof(Pixels));
+	for (y = 0; y < LCD_HEIGHT; y++)
+		for (x = 0; x < LCD_WIDTH; x++)
+			if (LCD_SIM_GetPixel(x, y))
+				Pixels[y][x / 8] |= 0x80u >> (x % 8);
+
+	fprintf(fpCounts, "%-20s %3u blits %5u data %4u command\n", pScenario->pName, Counters.Blits, Counters.DataBytes, Counters.CommandBytes);
+
+	snprintf(Path, sizeof(Path), "%s/%s.png", gOutputDir, pScenario->pName);
+	WritePng(Path, &Pixels[0][0]);
+
+	{	// PBM is the golden format, it's trivial to compare and any image viewer opens it
+		uint8_t Pbm[32 + sizeof(Pixels)];
+
+		memmove(Pbm, Header, HeaderSize);
+		memmove(Pbm + HeaderSize, Pixels, sizeof(Pixels));
+
+		snprintf(Path, sizeof(Path), "%s/%s.pbm", gOutputDir, pScenario->pName);
+		WriteFile(Path, Pbm, HeaderSize + sizeof(Pixels));
+
+		snprintf(Path, sizeof(Path), "%s/%s.pbm", gGoldenDir, pScenario->pName);
+		if (gUpdate)
+		{
+			WriteFile(Path, Pbm, HeaderSize + sizeof(Pixels));
+			return;
+		}
+
+		{
+			uint8_t File[sizeof(Pbm)];
+			bool    bOk = ReadFile(Path, File, HeaderSize + sizeof(Pixels));
+
+			if (bOk)
+			{
+				memmove(Golden, File + HeaderSize, sizeof(Golden));
+				bOk = memcmp(File, Header, HeaderSize) == 0 && memcmp(Golden, Pixels, sizeof(Pixels)) == 0;
+			}
+
+			printf("%-20s %s\n", pScenario->pName, bOk ? "ok" : "DIFFERS");
+			if (!bOk)
+				gFailures++;
+		}
+	}
+}
+
+static bool CompareCounts(const char *pGoldenPath, const char *pOutputPath)
+{
+	static char Golden[4096];
+	static char Output[4096];
+	FILE       *fp;
+	size_t      GoldenSize;
+	size_t      OutputSize;
+
+	fp = fopen(pGoldenPath, "rb");
+	if (fp == NULL)
+		return false;
+	GoldenSize = fread(Golden, 1, sizeof(Golden), fp);
+	fclose(fp);
+
+	fp = fopen(pOutputPath, "rb");
+	if (fp == NULL)
+		return false;
+	OutputSize = fread(Output, 1, sizeof(Output), fp);
+	fclose(fp);
+
+	return GoldenSize == OutputSize && memcmp(Golden, Output, GoldenSize) == 0;
+}
+
+int main(int argc, char *argv[])
+{
+	char         Path[512];
+	char         GoldenPath[512];
+	unsigned int i;
+	FILE        *fpCounts;
+
+	if (argc == 2 && strcmp(argv[1], "-b") == 0)
+	{
+		Benchmark();
+		return EXIT_SUCCESS;
+	}
+
+	if (argc > 1 && strcmp(argv[1], "-u") == 0)
+	{
+		gUpdate = true;
+		argc--;
+		argv++;
+	}
+
+	if (argc != 3)
+	{
+		fprintf(stderr, "usage: lcd_sim [-u] <golden dir> <output dir> | -b\n");
+		return EXIT_FAILURE;
+	}
+
+	gGoldenDir = argv[1];
+	gOutputDir = argv[2];
+
+	snprintf(Path, sizeof(Path), "%s/counts.txt", gOutputDir);
+	fpCounts = fopen(Path, "w");
+	if (fpCounts == NULL)
+	{
+		perror(Path);
+		return EXIT_FAILURE;
+	}
+
+	Sim_Init();
+	LCD_SIM_Reset();
+
+	for (i = 0; i < sizeof(Scenarios) / sizeof(Scenarios[0]); i++)
+		RunScenario(&Scenarios[i], fpCounts);
+
+	fclose(fpCounts);
+
+	{	// the byte counts catch a change that sends more than it needs to even when the picture is right
+		FILE *fp = fopen(Path, "r");
+		char  Line[128];
+
+		while (fgets(Line, sizeof(Line), fp) != NULL)
+			fputs(Line, stdout);
+		fclose(fp);
+	}
+
+	snprintf(GoldenPath, sizeof(GoldenPath), "%s/counts.txt", gGoldenDir);
+	if (gUpdate)
+	{
+		static char Counts[4096];
+		FILE       *fp   = fopen(Path, "rb");
+		const size_t Size = fread(Counts, 1, sizeof(Counts), fp);
+
+		fclose(fp);
+		WriteFile(GoldenPath, Counts, Size);
+		printf("goldens written to %s\n", gGoldenDir);
+		return EXIT_SUCCESS;
+	}
+
+	if (!CompareCounts(GoldenPath, Path))
+	{
+		printf("blit/byte counts differ from %s\n", GoldenPath);
+		gFailures++;
+	}
+
+	if (gFailures > 0)
+	{
+		printf("%u failed, see %s\n", gFailures, gOutputDir);
+		return EXIT_FAILURE;
+	}
+
+	printf("all passed\n");
+	return EXIT_SUCCESS;
+}
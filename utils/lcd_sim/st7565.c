@@ -0,0 +1,51 @@
+/* Host stand-in for driver/st7565.c, used by the display simulator in utils/lcd_sim/.
+ *
+ * This is the real driver built against the mock registers in utils/mock_regs.h, so the partial
+ * update and DMA paths the UI exercises are the ones that run on the radio, and every byte they put
+ * on the SPI bus lands in the mock ST7565's display RAM. The driver's own blit/byte counters are
+ * switched on here whether or not the firmware build has ENABLE_UART_SCREENSHOT.
+ */
+
+#ifndef ENABLE_UART_SCREENSHOT
+	#define ENABLE_UART_SCREENSHOT
+#endif
+
+#include "utils/mock_regs.h"
+#include "driver/st7565.c"
+#include "utils/lcd_sim/st7565.h"
+
+void LCD_SIM_Reset(void)
+{
+	Mock_Reset();
+	ST7565_Init(true);
+	LCD_SIM_ClearCounters();
+}
+
+void LCD_SIM_ClearCounters(void)
+{
+#ifdef ENABLE_LCD_DMA
+	ST7565_WaitForDma();
+#endif
+	gST7565_BlitCount      = 0;
+	gST7565_ByteCount      = 0;
+	gMockLcd.DataBytes     = 0;
+	gMockLcd.CommandBytes  = 0;
+	gMockLcd.DmaBytes      = 0;
+}
+
+void LCD_SIM_GetCounters(LCD_SIM_Counters_t *pCounters)
+{
+#ifdef ENABLE_LCD_DMA
+	ST7565_WaitForDma();
+#endif
+	pCounters->Blits        = gST7565_BlitCount;
+	pCounters->DataBytes    = gMockLcd.DataBytes;
+	pCounters->CommandBytes = gMockLcd.CommandBytes;
+}
+
+bool LCD_SIM_GetPixel(const unsigned int x, const unsigned int y)
+{	// what the glass shows, the driver puts screen column 0 at LCD column 4 and page 0 is the status line
+	const unsigned int Page = ((y + gMockLcd.StartLine) % LCD_HEIGHT) / 8;
+
+	return (gMockLcd.Ram[Page][x + 4] >> ((y + gMockLcd.StartLine) % 8)) & 1u;
+}
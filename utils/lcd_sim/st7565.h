@@ -0,0 +1,18 @@
+#ifndef UTILS_LCD_SIM_ST7565_H
+#define UTILS_LCD_SIM_ST7565_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef struct {
+	uint32_t Blits;          // full screen/status line blits
+	uint32_t DataBytes;      // bytes sent with A0 high
+	uint32_t CommandBytes;   // bytes sent with A0 low
+} LCD_SIM_Counters_t;
+
+void LCD_SIM_Reset(void);
+void LCD_SIM_ClearCounters(void);
+void LCD_SIM_GetCounters(LCD_SIM_Counters_t *pCounters);
+bool LCD_SIM_GetPixel(const unsigned int x, const unsigned int y);
+
+#endif
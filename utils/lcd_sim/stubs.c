@@ -0,0 +1,240 @@
+/* The rest of the firmware as far as the UI code sees it, for the display simulator in utils/lcd_sim/.
+ *
+ * The UI code only reads radio state, so the state lives here as plain globals that the scenarios in
+ * lcd_sim.c fill in. The EEPROM is a RAM image, BOARD_fetchChannelFrequency/Name and the DTMF
+ * contact lookup read it the way board.c and app/dtmf.c do.
+ */
+
+#include <string.h>
+
+#include "app/chFrScanner.h"
+#include "app/dtmf.h"
+#ifdef ENABLE_FMRADIO
+	#include "app/fm.h"
+#endif
+#include "app/scanner.h"
+#include "board.h"
+#include "driver/backlight.h"
+#include "driver/bk4819.h"
+#include "driver/eeprom.h"
+#include "driver/keyboard.h"
+#include "functions.h"
+#include "helper/battery.h"
+#include "misc.h"
+#include "radio.h"
+#include "ui/ui.h"
+#include "utils/lcd_sim/stubs.h"
+
+uint8_t  gSimEeprom[0x2000];
+uint16_t gSimVoiceAmplitude;
+
+// radio.c
+VFO_Info_t      *gTxVfo;
+VFO_Info_t      *gRxVfo;
+VFO_Info_t      *gCurrentVfo;
+VfoState_t       VfoState[2];
+
+const char gModulationStr[][4] =
+{
+	"FM",
+	"AM",
+	"USB",
+#ifdef ENABLE_BYP_RAW_DEMODULATORS
+	"BYP",
+	"RAW"
+#endif
+};
+
+// functions.c
+FUNCTION_Type_t  gCurrentFunction;
+
+// helper/battery.c
+uint16_t         gBatteryCalibration[6];
+uint16_t         gBatteryVoltageAverage;
+uint8_t          gBatteryDisplayLevel;
+bool             gChargingWithTypeC;
+bool             gLowBatteryBlink;
+bool             gLowBattery;
+bool             gLowBatteryConfirmed;
+
+// app/dtmf.c
+char             gDTMF_String[15];
+char             gDTMF_InputBox[15];
+uint8_t          gDTMF_InputBox_Index;
+bool             gDTMF_InputMode;
+char             gDTMF_RX[17];
+uint8_t          gDTMF_RX_index;
+char             gDTMF_RX_live[20];
+bool             gIsDtmfContactValid;
+char             gDTMF_ID[4];
+char             gDTMF_Caller[4];
+char             gDTMF_Callee[4];
+DTMF_State_t     gDTMF_State;
+DTMF_CallState_t gDTMF_CallState;
+bool             gDTMF_IsTx;
+
+// app/scanner.c, app/chFrScanner.c
+DCS_CodeType_t   gScanCssResultType;
+uint8_t          gScanCssResultCode;
+bool             gScanSingleFrequency;
+SCAN_SaveState_t gScannerSaveState;
+uint8_t          gScanChannel;
+uint32_t         gScanFrequency;
+SCAN_CssState_t  gScanCssState;
+uint8_t          gScanProgressIndicator;
+bool             gScanUseCssResult;
+int8_t           gScanStateDir;
+
+#ifdef ENABLE_FMRADIO
+	// app/fm.c
+	uint16_t         gFM_Channels[20];
+	volatile int8_t  gFM_ScanState;
+	bool             gFM_AutoScan;
+	uint8_t          gFM_ChannelPosition;
+#endif
+
+// driver/keyboard.c, driver/eeprom.c
+bool             gWasFKeyPressed;
+uint16_t         gEepromWriteCount;
+
+// version.c, fixed so the golden images don't change with the git hash
+const char Version[] = "OEFW-lcdsim";
+
+void EEPROM_ReadBuffer(uint16_t Address, void *pBuffer, uint8_t Size)
+{
+	memmove(pBuffer, &gSimEeprom[Address % sizeof(gSimEeprom)], Size);
+}
+
+void EEPROM_WriteBuffer(uint16_t Address, const void *pBuffer)
+{
+	memmove(&gSimEeprom[Address % sizeof(gSimEeprom)], pBuffer, 8);
+}
+
+#ifdef ENABLE_CHANNEL_TABLE
+	void BOARD_UpdateChannelTable(uint16_t Address, const void *pData)
+	{
+		(void)Address;
+		(void)pData;
+	}
+#endif
+
+uint32_t BOARD_fetchChannelFrequency(const int channel)
+{
+	uint32_t Frequency;
+
+	EEPROM_ReadBuffer(channel * 16, &Frequency, sizeof(Frequency));
+	return Frequency;
+}
+
+void BOARD_fetchChannelName(char *s, const int channel)
+{
+	int i;
+
+	memset(s, 0, 11);
+
+	if (channel < 0 || !RADIO_CheckValidChannel(channel, false, 0))
+		return;
+
+	EEPROM_ReadBuffer(0x0F50 + (channel * 16), s, 10);
+
+	for (i = 0; i < 10; i++)
+		if (s[i] < 32 || s[i] > 127)
+			break;
+
+	s[i--] = 0;
+
+	while (i >= 0 && s[i] == 32)
+		s[i--] = 0;
+}
+
+bool RADIO_CheckValidChannel(uint16_t Channel, bool bCheckScanList, uint8_t VFO)
+{
+	(void)bCheckScanList;
+	(void)VFO;
+
+	return IS_MR_CHANNEL(Channel) && (gMR_ChannelAttributes[Channel] & MR_CH_BAND_MASK) <= BAND7_470MHz;
+}
+
+unsigned int BATTERY_VoltsToPercent(const unsigned int voltage_10mV)
+{	// straight line between the empty and full calibration points is close enough for a picture
+	if (voltage_10mV <= gBatteryCalibration[0])
+		return 0;
+	if (voltage_10mV >= gBatteryCalibration[5])
+		return 100;
+	return ((voltage_10mV - gBatteryCalibration[0]) * 100u) / (gBatteryCalibration[5] - gBatteryCalibration[0]);
+}
+
+bool DTMF_GetContact(const int Index, char *pContact)
+{
+	int i = -1;
+
+	if (Index >= 0 && Index < MAX_DTMF_CONTACTS && pContact != NULL)
+	{
+		EEPROM_ReadBuffer(0x1C00 + (Index * 16), pContact, 16);
+		i = (int)pContact[0] - ' ';
+	}
+	return (i < 0 || i >= 95) ? false : true;
+}
+
+bool DTMF_FindContact(const char *pContact, char *pResult)
+{
+	char         Contact[16];
+	unsigned int i;
+
+	for (i = 0; i < MAX_DTMF_CONTACTS; i++)
+	{
+		if (!DTMF_GetContact(i, Contact))
+			return false;
+
+		if (memcmp(pContact, Contact + 8, 3) == 0)
+		{
+			memmove(pResult, Contact, 8);
+			pResult[8] = 0;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void DTMF_clear_input_box(void)
+{
+	memset(gDTMF_InputBox, 0, sizeof(gDTMF_InputBox));
+	gDTMF_InputBox_Index = 0;
+	gDTMF_InputMode      = false;
+}
+
+#ifdef ENABLE_SCAN_PLAN
+void CHFRSCANNER_Cancel(void)
+{
+}
+#endif
+
+bool SCANNER_IsScanning(void)
+{
+	return gCssBackgroundScan || (gScreenToDisplay == DISPLAY_SCANNER);
+}
+
+void BACKLIGHT_SetBrightness(uint8_t brigtness)
+{
+	(void)brigtness;
+}
+
+uint16_t BK4819_GetVoiceAmplitudeOut(void)
+{
+	return gSimVoiceAmplitude;
+}
+
+void BK4819_EnableScramble(uint8_t Type)
+{
+	(void)Type;
+}
+
+void BK4819_DisableScramble(void)
+{
+}
+
+void _putchar(char c)
+{
+	(void)c;
+}
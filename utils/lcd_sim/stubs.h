@@ -0,0 +1,9 @@
+#ifndef UTILS_LCD_SIM_STUBS_H
+#define UTILS_LCD_SIM_STUBS_H
+
+#include <stdint.h>
+
+extern uint8_t  gSimEeprom[0x2000];     // the BL24C64 contents
+extern uint16_t gSimVoiceAmplitude;     // what BK4819_GetVoiceAmplitudeOut returns, drives the mic bar
+
+#endif
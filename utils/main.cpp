@@ -17,6 +17,7 @@
 
 #include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <vector>
 
@@ -346,7 +347,413 @@ void create_gain_table(const char *filename)
 	fclose(file);
 }
 
-	// ************************************************************************
+// ************************************************************************
+// load a text file, NULL terminated
+
+bool load_text_file(const char *filename, std::vector <char> &data)
+{
+	data.clear();
+
+	FILE *file = fopen(filename, "rb");
+	if (file == NULL)
+		return false;
+
+	while (true)
+	{
+		const int c = fgetc(file);
+		if (c == EOF)
+			break;
+		data.push_back((char)c);
+	}
+	data.push_back(0);
+
+	fclose(file);
+
+	return true;
+}
+
+// ************************************************************************
+// create the sorted UTF-8 -> glyph index table for the Chinese fonts
+//
+// the firmware binary searches this table instead of scanning 'CNList'
+// for every character it prints, re-run this after editing 'CNList'
+
+void create_cn_index(const char *font_filename, const char *filename)
+{
+	std::vector <uint32_t> index;
+
+	if (font_filename == NULL || filename == NULL)
+		return;
+
+	// ****************************
+	// load the font source file
+
+	std::vector <char> data;
+	if (!load_text_file(font_filename, data))
+		return;
+
+	// ****************************
+	// find the glyph list
+
+	const char *list = strstr(&data[0], "CNList = \"");
+	if (list == NULL)
+		return;
+	list += strlen("CNList = \"");
+
+	const char *end = strchr(list, '"');
+	if (end == NULL)
+		return;
+
+	// the glyphs are all 3-byte UTF-8 sequences, stored in the same order as CNFont14[] and CNFont6[]
+	for (unsigned int i = 0; (list + (i * 3) + 3) <= end; i++)
+	{
+		const uint8_t *p   = (const uint8_t *)list + (i * 3);
+		const uint32_t key = ((uint32_t)p[0] << 16) | ((uint32_t)p[1] << 8) | p[2];
+
+		bool duplicate = false;
+		for (unsigned int k = 0; k < index.size(); k++)
+			if ((index[k] >> 8) == key)
+				duplicate = true;      // the first one wins, same as the old linear search
+
+		if (!duplicate)
+			index.push_back((key << 8) | i);
+	}
+
+	// sort the table according to the UTF-8 sequence
+	for (unsigned int i = 0; i + 1 < index.size(); i++)
+	{
+		for (unsigned int k = i + 1; k < index.size(); k++)
+		{
+			if (index[k] < index[i])
+			{	// swap
+				const uint32_t entry = index[i];
+				index[i] = index[k];
+				index[k] = entry;
+			}
+		}
+	}
+
+	// ***************************
+	// save the table to a file
+
+	FILE *file = fopen(filename, "w");
+	if (file == NULL)
+		return;
+
+	fprintf(file, "// UTF-8 sequence << 8 | glyph index, sorted - generated by utils/main.cpp from CNList\n");
+	fprintf(file, "const uint32_t CNIndex[] =\n");
+	fprintf(file, "{\n");
+
+	for (unsigned int i = 0; i < index.size(); i++)
+	{
+		const uint32_t key = index[i] >> 8;
+		char utf8[4];
+		utf8[0] = (char)(key >> 16);
+		utf8[1] = (char)(key >> 8);
+		utf8[2] = (char)(key >> 0);
+		utf8[3] = 0;
+		fprintf(file, "\t0x%08X,   // %s %u\n", index[i], utf8, index[i] & 0xFF);
+	}
+
+	fprintf(file, "};\n\n");
+
+	fprintf(file, "const unsigned int CNIndexCount = sizeof(CNIndex) / sizeof(CNIndex[0]);\n");
+
+	fclose(file);
+}
+
+// ************************************************************************
+// create the packed Chinese fonts
+//
+// 'CNFont14' glyphs are 14 x 14 pixels but take up 2 whole display pages
+// (16 rows), 'CNFont6' glyphs are 6 x 6 and take up 1 page (8 rows). The
+// packed tables store only the used rows of each column, back to back, so
+// glyph 'g' column 'c' starts at bit ((g * width) + c) * height.
+// Re-run this after editing 'CNFont14' or 'CNFont6' in font.c
+
+// reads the hex values of a 'const uint8_t name[][n] = { .. };' array, skipping comments
+bool load_font_array(const char *src, const char *name, std::vector <uint8_t> &values)
+{
+	values.clear();
+
+	char pattern[64];
+	sprintf(pattern, "const uint8_t %s[]", name);
+
+	const char *p = strstr(src, pattern);
+	if (p == NULL)
+		return false;
+
+	p = strchr(p, '{');
+	if (p == NULL)
+		return false;
+
+	while (*p != 0)
+	{
+		if (p[0] == '/' && p[1] == '*')
+		{
+			p = strstr(p + 2, "*/");
+			if (p == NULL)
+				return false;
+			p += 2;
+		}
+		else
+		if (p[0] == '/' && p[1] == '/')
+		{
+			while (*p != 0 && *p != '\n')
+				p++;
+		}
+		else
+		if (p[0] == '}' && p[1] == ';')
+			break;
+		else
+		if (p[0] == '0' && (p[1] == 'x' || p[1] == 'X'))
+		{
+			char *end;
+			values.push_back((uint8_t)strtoul(p, &end, 16));
+			p = end;
+		}
+		else
+			p++;
+	}
+
+	return !values.empty();
+}
+
+// packs the 'height' used rows of each 'pages' tall column
+std::vector <uint8_t> pack_font(const std::vector <uint8_t> &font, const unsigned int width, const unsigned int pages, const unsigned int height)
+{
+	std::vector <uint8_t> packed;
+	const unsigned int    glyphs = font.size() / (width * pages);
+	unsigned int          bit    = 0;
+
+	packed.resize(((glyphs * width * height) + 7) / 8, 0);
+
+	for (unsigned int g = 0; g < glyphs; g++)
+	{
+		const uint8_t *glyph = &font[g * width * pages];
+
+		for (unsigned int c = 0; c < width; c++)
+		{
+			uint32_t column = 0;
+			for (unsigned int k = 0; k < pages; k++)
+				column |= (uint32_t)glyph[(k * width) + c] << (k * 8);
+
+			for (unsigned int r = 0; r < height; r++, bit++)
+				if (column & (1u << r))
+					packed[bit / 8] |= 1u << (bit % 8);
+		}
+	}
+
+	return packed;
+}
+
+// same as the firmware decoder in ui/helper.c, used to check the packed table
+void unpack_glyph(const uint8_t *packed, const unsigned int g, const unsigned int width, const unsigned int pages, const unsigned int height, uint8_t *out)
+{
+	const unsigned int offset = g * width * height;
+	const uint8_t     *p      = packed + (offset / 8);
+	uint32_t           bits   = *p++ >> (offset % 8);
+	unsigned int       avail  = 8 - (offset % 8);
+
+	for (unsigned int c = 0; c < width; c++)
+	{
+		while (avail < height)
+		{
+			bits  |= (uint32_t)*p++ << avail;
+			avail += 8;
+		}
+
+		const uint32_t column = bits & ((1u << height) - 1);
+		for (unsigned int k = 0; k < pages; k++)
+			out[(k * width) + c] = (uint8_t)(column >> (k * 8));
+
+		bits  >>= height;
+		avail  -= height;
+	}
+}
+
+bool write_packed_font(FILE *file, const char *src, const char *name, const unsigned int width, const unsigned int pages, const unsigned int height)
+{
+	std::vector <uint8_t> font;
+	if (!load_font_array(src, name, font))
+	{
+		printf("%s not found\n", name);
+		return false;
+	}
+
+	for (unsigned int i = 0; i < font.size(); i++)
+	{
+		const unsigned int row = ((i / width) % pages) * 8;
+		if (row + 8 > height && (font[i] >> (height - row)) != 0)
+		{
+			printf("%s glyph %u is taller than %u pixels\n", name, (unsigned int)(i / (width * pages)), height);
+			return false;
+		}
+	}
+
+	const std::vector <uint8_t> packed = pack_font(font, width, pages, height);
+	const unsigned int          glyphs = font.size() / (width * pages);
+
+	for (unsigned int g = 0; g < glyphs; g++)
+	{
+		uint8_t glyph[32];
+		unpack_glyph(&packed[0], g, width, pages, height, glyph);
+		if (memcmp(glyph, &font[g * width * pages], width * pages) != 0)
+		{
+			printf("%s glyph %u doesn't unpack\n", name, g);
+			return false;
+		}
+	}
+
+	fprintf(file, "// %u glyphs, %u x %u pixels, %u bytes (%u unpacked) - generated by utils/main.cpp from %s[]\n", glyphs, width, height, (unsigned int)packed.size(), (unsigned int)font.size(), name);
+	fprintf(file, "const uint8_t %sPacked[] =\n", name);
+	fprintf(file, "{\n");
+
+	for (unsigned int i = 0; i < packed.size(); i++)
+	{
+		if ((i % 16) == 0)
+			fprintf(file, "\t");
+		fprintf(file, "0x%02X,", packed[i]);
+		fprintf(file, ((i % 16) == 15 || (i + 1) == packed.size()) ? "\n" : " ");
+	}
+
+	fprintf(file, "};\n\n");
+
+	return true;
+}
+
+void create_packed_cn_fonts(const char *font_filename, const char *filename)
+{
+	if (font_filename == NULL || filename == NULL)
+		return;
+
+	std::vector <char> data;
+	if (!load_text_file(font_filename, data))
+		return;
+
+	FILE *file = fopen(filename, "w");
+	if (file == NULL)
+		return;
+
+	write_packed_font(file, &data[0], "CNFont14", 14, 2, 14);
+	write_packed_font(file, &data[0], "CNFont6",  6,  1, 6);
+
+	fclose(file);
+}
+
+// ************************************************************************
+// create the menu name glyph strings
+//
+// with ENABLE_MENU_GLYPHS the firmware keeps each MenuList name already
+// decoded to glyph codes (see UI_GLYPH_ASCII/UI_GLYPH_CN in ui/helper.h),
+// drawing the menu then needs no strlen(), UTF-8 decoding or glyph search.
+// Re-run this after editing a MENU_ITEM() name in ui/menu.c or 'CNList'
+
+void create_menu_glyphs(const char *menu_filename, const char *font_filename, const char *filename)
+{
+	if (menu_filename == NULL || font_filename == NULL || filename == NULL)
+		return;
+
+	std::vector <char> menu;
+	std::vector <char> font;
+	if (!load_text_file(menu_filename, menu) || !load_text_file(font_filename, font))
+		return;
+
+	const char *list = strstr(&font[0], "CNList = \"");
+	if (list == NULL)
+		return;
+	list += strlen("CNList = \"");
+
+	const char *list_end = strchr(list, '"');
+	if (list_end == NULL)
+		return;
+
+	FILE *file = fopen(filename, "w");
+	if (file == NULL)
+		return;
+
+	fprintf(file, "// MenuList names as glyph strings - generated by utils/main.cpp from the MENU_ITEM() names in ui/menu.c\n");
+	fprintf(file, "// byte 0 is the UTF-8 length of the name, then the glyph codes\n\n");
+	fprintf(file, "#ifndef UI_MENU_GLYPHS_H\n");
+	fprintf(file, "#define UI_MENU_GLYPHS_H\n\n");
+
+	const char *p = &menu[0];
+	while ((p = strstr(p, "MENU_ITEM(\"")) != NULL)
+	{
+		p += strlen("MENU_ITEM(\"");
+
+		const char *text_end = strchr(p, '"');
+		if (text_end == NULL)
+			break;
+
+		// the menu ID is the third argument
+		const char *id = strchr(text_end, ',');
+		if (id != NULL)
+			id = strchr(id + 1, ',');
+		if (id == NULL)
+			break;
+		for (id++; *id == ' ' || *id == '\t'; id++) {}
+
+		unsigned int id_len = 0;
+		while ((id[id_len] >= 'A' && id[id_len] <= 'Z') || (id[id_len] >= '0' && id[id_len] <= '9') || id[id_len] == '_')
+			id_len++;
+
+		const unsigned int text_len = text_end - p;
+		uint8_t            glyphs[7];
+		unsigned int       count = 0;
+
+		memset(glyphs, 0, sizeof(glyphs));
+		glyphs[0] = text_len;
+
+		for (unsigned int i = 0; i < text_len; )
+		{
+			const uint8_t *c = (const uint8_t *)p + i;
+
+			if (count >= 6)
+			{
+				printf("%.*s: more than 6 glyphs\n", id_len, id);
+				break;
+			}
+
+			if (c[0] >= ' ' && c[0] < 127)
+			{	// UI_GLYPH_ASCII()
+				glyphs[1 + count++] = c[0] - ' ' + 1;
+				i++;
+				continue;
+			}
+
+			// UI_GLYPH_CN(), the first match in CNList like the firmware's glyph index
+			unsigned int g;
+			for (g = 0; (list + (g * 3) + 3) <= list_end; g++)
+				if (memcmp(list + (g * 3), c, 3) == 0)
+					break;
+
+			if ((c[0] & 0xF0) != 0xE0 || (i + 3) > text_len || (list + (g * 3) + 3) > list_end)
+			{
+				printf("%.*s: character at byte %u isn't in the fonts\n", id_len, id, i);
+				break;
+			}
+
+			glyphs[1 + count++] = 0x60 + g;
+			i += 3;
+		}
+
+		char name[40];
+		sprintf(name, "GLYPHS_%.*s", id_len, id);
+		fprintf(file, "#define %-26s {%u", name, glyphs[0]);
+		for (unsigned int i = 1; i < sizeof(glyphs); i++)
+			fprintf(file, ", 0x%02X", glyphs[i]);
+		fprintf(file, "}   // %.*s\n", text_len, p);
+
+		p = text_end;
+	}
+
+	fprintf(file, "\n#endif\n");
+
+	fclose(file);
+}
+
+// ************************************************************************
 // "rotate_font()" has nothing to do with this program at all, I just needed
 // to write a bit of code to rotate some fonts I've drawn
 
@@ -469,5 +876,9 @@ int main(int argc, char* argv[])
 	rotate_font("uv-k5_small.bin",      "uv-k5_small.c");
 	rotate_font("uv-k5_small_bold.bin", "uv-k5_small_bold.c");
 
+	create_cn_index("../font.c", "cn_index.c");
+	create_packed_cn_fonts("../font.c", "cn_font_packed.c");
+	create_menu_glyphs("../ui/menu.c", "../font.c", "../ui/menu_glyphs.h");
+
 	return 0;
 }
@@ -0,0 +1,263 @@
+/* Host mock of the BK4819 3-wire bus (GPIOC SCN/SCL/SDA) and of the chip on the other end of it, for
+ * the host tests in utils/.
+ *
+ * Include it before the driver source under test:
+ *
+ *   #include "utils/mock_bk4819.h"
+ *   #include "driver/bk4819.c"
+ *
+ * GPIOC and PORTCON_PORTC_IE are pointed at RAM. Plain C can't trap a register write, so every GPIOC
+ * access first looks at what the code left in GPIOC->DATA since the last access and hands the pin
+ * changes to the model chip, the same trick utils/mock_regs.h uses for the SPI.
+ *
+ * Time is counted in CPU cycles and only moves in the delays, SYSTICK_DelayUs() and
+ * SYSTICK_DELAY_CYCLES(). GPIO accesses take no time at all, which is the worst case for the timing
+ * checks: whatever the real accesses take only adds to the times the model sees. The accesses are
+ * counted though, for an estimate of how long a transaction takes on the radio.
+ *
+ * The model chip keeps a register file, checks every edge against the minimum times below and puts
+ * read data on SDA only MOCK_BK4819_ACCESS_NS after the SCL falling edge, so a read that samples too
+ * early gets the previous bit.
+ */
+
+#ifndef UTILS_MOCK_BK4819_H
+#define UTILS_MOCK_BK4819_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "bsp/dp32g030/gpio.h"
+#include "bsp/dp32g030/portcon.h"
+#include "driver/gpio.h"
+#include "driver/systick.h"
+
+// the bus times the model holds the driver to, in ns. These are the figures ENABLE_BK4819_FAST_BUS is
+// built for (BUS_HALF_CLOCK_NS in driver/bk4819.c), not datasheet numbers
+#define MOCK_BK4819_SETUP_NS      250u   // SDA stable before SCL rises
+#define MOCK_BK4819_HOLD_NS       250u   // SDA stable after SCL rises
+#define MOCK_BK4819_HIGH_NS       250u   // SCL high
+#define MOCK_BK4819_LOW_NS        250u   // SCL low, within a transaction
+#define MOCK_BK4819_SCN_SETUP_NS  250u   // SCN low before the first SCL rising edge
+#define MOCK_BK4819_SCN_HOLD_NS   250u   // last SCL edge before SCN goes high
+#define MOCK_BK4819_ACCESS_NS     250u   // SCL falling edge to read data on SDA
+
+#define MOCK_CYCLES_TO_NS(cycles) (((cycles) * 1000u) / SYSTICK_CPU_MHZ)
+
+enum {
+	MOCK_BK4819_SETUP = 0,
+	MOCK_BK4819_HOLD,
+	MOCK_BK4819_HIGH,
+	MOCK_BK4819_LOW,
+	MOCK_BK4819_SCN_SETUP,
+	MOCK_BK4819_SCN_HOLD,
+	MOCK_BK4819_TIMINGS
+};
+
+typedef struct {
+	uint16_t Reg[128];
+	uint32_t Writes;                            // complete register writes
+	uint32_t Reads;                             // complete register reads
+	uint32_t BadTransactions;                   // SCN went high after other than 24 clocks
+	uint32_t Violations[MOCK_BK4819_TIMINGS];   // edges that came too soon
+	uint64_t Shortest[MOCK_BK4819_TIMINGS];     // shortest time seen for each, in cycles
+
+	// bus state
+	uint32_t Pins;                              // SCN/SCL/SDA levels last seen
+	bool     Selected;
+	uint8_t  Bits;
+	uint32_t Shift;
+	bool     Reading;
+	uint16_t ReadValue;
+	uint8_t  OutBit;                            // the level the chip drives SDA to
+	uint8_t  NextOutBit;
+	uint64_t OutBitAt;                          // when NextOutBit gets to SDA
+	uint64_t SdaChangedAt;
+	uint64_t SclRoseAt;
+	uint64_t SclFellAt;
+	uint64_t SelectedAt;
+	bool     Clocked;                           // an SCL edge since SCN went low
+} MockBk4819_t;
+
+static MockBk4819_t gMockBk4819;
+static GPIO_Bank_t  gMockGpioC;
+static uint32_t     gMockPortcIe;
+static uint64_t     gMockCycles;                // model time
+static uint32_t     gMockGpioAccesses;
+
+static const uint64_t gMockMinimum[MOCK_BK4819_TIMINGS] =
+{
+	SYSTICK_NS_TO_CYCLES(MOCK_BK4819_SETUP_NS),
+	SYSTICK_NS_TO_CYCLES(MOCK_BK4819_HOLD_NS),
+	SYSTICK_NS_TO_CYCLES(MOCK_BK4819_HIGH_NS),
+	SYSTICK_NS_TO_CYCLES(MOCK_BK4819_LOW_NS),
+	SYSTICK_NS_TO_CYCLES(MOCK_BK4819_SCN_SETUP_NS),
+	SYSTICK_NS_TO_CYCLES(MOCK_BK4819_SCN_HOLD_NS)
+};
+
+static const char *const gMockTimingName[MOCK_BK4819_TIMINGS] =
+{
+	"SDA setup", "SDA hold", "SCL high", "SCL low", "SCN setup", "SCN hold"
+};
+
+static void MockBk4819_Time(const unsigned int Timing, const uint64_t Since)
+{
+	const uint64_t Cycles = gMockCycles - Since;
+
+	if (Cycles < gMockBk4819.Shortest[Timing])
+		gMockBk4819.Shortest[Timing] = Cycles;
+	if (Cycles < gMockMinimum[Timing])
+		gMockBk4819.Violations[Timing]++;
+}
+
+static bool MockBk4819_SdaIsInput(void)
+{
+	return (gMockGpioC.DIR & GPIO_DIR_2_MASK) == GPIO_DIR_2_BITS_INPUT;
+}
+
+static void MockBk4819_Edges(const uint32_t Pins)
+{
+	const uint32_t Changed = Pins ^ gMockBk4819.Pins;
+	const bool     Scn     = (Pins >> GPIOC_PIN_BK4819_SCN) & 1u;
+	const bool     Scl     = (Pins >> GPIOC_PIN_BK4819_SCL) & 1u;
+	const bool     Sda     = (Pins >> GPIOC_PIN_BK4819_SDA) & 1u;
+
+	gMockBk4819.Pins = Pins;
+
+	if (Changed & (1u << GPIOC_PIN_BK4819_SDA))
+	{	// the driver moved SDA, the chip samples it on the SCL rising edge
+		if (gMockBk4819.Selected && !Scl && gMockBk4819.Clocked)
+			MockBk4819_Time(MOCK_BK4819_HOLD, gMockBk4819.SclRoseAt);
+		gMockBk4819.SdaChangedAt = gMockCycles;
+	}
+
+	if (Changed & (1u << GPIOC_PIN_BK4819_SCN))
+	{
+		if (!Scn)
+		{	// start of a transaction
+			gMockBk4819.Selected   = true;
+			gMockBk4819.SelectedAt = gMockCycles;
+			gMockBk4819.Clocked    = false;
+			gMockBk4819.Bits       = 0;
+			gMockBk4819.Shift      = 0;
+			gMockBk4819.Reading    = false;
+		}
+		else
+		if (gMockBk4819.Selected)
+		{	// end of one
+			gMockBk4819.Selected = false;
+			if (gMockBk4819.Clocked)
+				MockBk4819_Time(MOCK_BK4819_SCN_HOLD, (gMockBk4819.SclFellAt > gMockBk4819.SclRoseAt) ? gMockBk4819.SclFellAt : gMockBk4819.SclRoseAt);
+
+			if (gMockBk4819.Bits != 24)
+				gMockBk4819.BadTransactions++;
+			else
+			if (gMockBk4819.Reading)
+				gMockBk4819.Reads++;
+			else
+			{
+				gMockBk4819.Reg[(gMockBk4819.Shift >> 16) & 0x7F] = gMockBk4819.Shift & 0xFFFF;
+				gMockBk4819.Writes++;
+			}
+		}
+	}
+
+	if ((Changed & (1u << GPIOC_PIN_BK4819_SCL)) && gMockBk4819.Selected)
+	{
+		if (Scl)
+		{	// rising edge, the chip samples SDA
+			if (!gMockBk4819.Clocked)
+				MockBk4819_Time(MOCK_BK4819_SCN_SETUP, gMockBk4819.SelectedAt);
+			else
+				MockBk4819_Time(MOCK_BK4819_LOW, gMockBk4819.SclFellAt);
+
+			if (!gMockBk4819.Reading)
+			{
+				MockBk4819_Time(MOCK_BK4819_SETUP, gMockBk4819.SdaChangedAt);
+				gMockBk4819.Shift = (gMockBk4819.Shift << 1) | Sda;
+			}
+
+			gMockBk4819.Bits++;
+			gMockBk4819.Clocked   = true;
+			gMockBk4819.SclRoseAt = gMockCycles;
+
+			if (gMockBk4819.Bits == 8 && (gMockBk4819.Shift & 0x80))
+			{	// a read, the register goes out MSB first from the next falling edge
+				gMockBk4819.Reading   = true;
+				gMockBk4819.ReadValue = gMockBk4819.Reg[gMockBk4819.Shift & 0x7F];
+			}
+		}
+		else
+		{	// falling edge
+			MockBk4819_Time(MOCK_BK4819_HIGH, gMockBk4819.SclRoseAt);
+			gMockBk4819.SclFellAt = gMockCycles;
+
+			if (gMockBk4819.Reading && gMockBk4819.Bits >= 8 && gMockBk4819.Bits < 24)
+			{
+				gMockBk4819.NextOutBit = (gMockBk4819.ReadValue >> (23 - gMockBk4819.Bits)) & 1u;
+				gMockBk4819.OutBitAt   = gMockCycles + SYSTICK_NS_TO_CYCLES(MOCK_BK4819_ACCESS_NS);
+			}
+		}
+	}
+}
+
+static void MockBk4819_Sync(void)
+{	// hand what the code did to the pins since the last access to the chip, and put its SDA level in DATA
+	const uint32_t Mask = (1u << GPIOC_PIN_BK4819_SCN) | (1u << GPIOC_PIN_BK4819_SCL) | (1u << GPIOC_PIN_BK4819_SDA);
+	uint32_t       Pins = gMockGpioC.DATA & Mask;
+
+	if (MockBk4819_SdaIsInput())
+		Pins = (Pins & ~(1u << GPIOC_PIN_BK4819_SDA)) | (gMockBk4819.Pins & (1u << GPIOC_PIN_BK4819_SDA));
+
+	if (Pins != gMockBk4819.Pins)
+		MockBk4819_Edges(Pins);
+
+	if (gMockBk4819.Reading && gMockCycles >= gMockBk4819.OutBitAt)
+		gMockBk4819.OutBit = gMockBk4819.NextOutBit;
+
+	if (MockBk4819_SdaIsInput())
+		gMockGpioC.DATA = (gMockGpioC.DATA & ~(1u << GPIOC_PIN_BK4819_SDA)) | ((uint32_t)gMockBk4819.OutBit << GPIOC_PIN_BK4819_SDA);
+}
+
+static volatile GPIO_Bank_t *MockGpioC(void)
+{
+	MockBk4819_Sync();
+	gMockGpioAccesses++;
+	return &gMockGpioC;
+}
+
+static void MockBk4819_Wait(const uint32_t Cycles)
+{	// pin changes before the wait happened before it
+	MockBk4819_Sync();
+	gMockCycles += Cycles;
+}
+
+static void MockBk4819_Reset(void)
+{
+	unsigned int i;
+
+	memset(&gMockBk4819, 0, sizeof(gMockBk4819));
+	for (i = 0; i < MOCK_BK4819_TIMINGS; i++)
+		gMockBk4819.Shortest[i] = UINT64_MAX;
+
+	gMockGpioC.DATA   = (1u << GPIOC_PIN_BK4819_SCN) | (1u << GPIOC_PIN_BK4819_SCL) | (1u << GPIOC_PIN_BK4819_SDA);
+	gMockGpioC.DIR    = GPIO_DIR_2_BITS_OUTPUT;
+	gMockBk4819.Pins  = gMockGpioC.DATA;
+	gMockCycles       = 0;
+	gMockGpioAccesses = 0;
+}
+
+#undef  GPIOC
+#define GPIOC                    (MockGpioC())
+#undef  PORTCON_PORTC_IE
+#define PORTCON_PORTC_IE         gMockPortcIe
+#undef  SYSTICK_DELAY_CYCLES
+#define SYSTICK_DELAY_CYCLES(n)  MockBk4819_Wait(n)
+
+// driver/systick.c stand-in, it waits at least this long
+void SYSTICK_DelayUs(uint32_t Delay)
+{
+	MockBk4819_Wait(Delay * SYSTICK_CPU_MHZ);
+}
+
+#endif
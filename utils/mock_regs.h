@@ -0,0 +1,196 @@
+/* Host mock of the DP32G030 registers the display driver touches, for the host tests in utils/.
+ *
+ * Include it before the driver source under test:
+ *
+ *   #include "utils/mock_regs.h"
+ *   #include "driver/st7565.c"
+ *
+ * The bsp headers are pulled in first, then SPI0, GPIOB, DMA_CTR, DMA_INTST and DMA_CH1 are pointed
+ * at RAM. Plain C can't trap a register write, so every access to SPI0 or GPIOB first looks at what
+ * the code left in SPI0->WDR since the last access and shifts it into a model of the ST7565, with the
+ * A0 level it had at the time (the sentinel value in WDR means nothing was written). The DMA channel
+ * moves a few bytes each time DMA_INTST is polled, so the driver sees a transfer that takes a while.
+ */
+
+#ifndef UTILS_MOCK_REGS_H
+#define UTILS_MOCK_REGS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "bsp/dp32g030/dma.h"
+#include "bsp/dp32g030/gpio.h"
+#include "bsp/dp32g030/spi.h"
+#include "driver/gpio.h"
+#include "driver/spi.h"
+#include "driver/system.h"
+
+#define MOCK_WDR_IDLE           0xFFFFFFFFu
+
+// bytes the DMA moves into the SPI FIFO per DMA_INTST poll
+#define MOCK_DMA_BYTES_PER_POLL 8u
+
+typedef struct {
+	uint8_t  Ram[8][132];        // display RAM, page 0 is the status line
+	uint8_t  Page;
+	uint8_t  Column;
+	uint8_t  StartLine;
+	uint32_t DataBytes;          // A0 high
+	uint32_t CommandBytes;       // A0 low
+	uint32_t DmaBytes;           // data bytes that came from the DMA
+} MockLcd_t;
+
+static MockLcd_t      gMockLcd;
+static SPI_Port_t     gMockSpi0;
+static GPIO_Bank_t    gMockGpioB;
+static DMA_Channel_t  gMockDmaCh1;
+static uint32_t       gMockDmaCtr;
+static uint32_t       gMockDmaIntst;
+static uint32_t       gMockDmaDone;    // bytes of the current DMA_CH1 transfer already sent
+
+static void MockLcd_Byte(const uint8_t Value, const bool bData)
+{
+	if (bData)
+	{
+		if (gMockLcd.Page < 8 && gMockLcd.Column < 132)
+			gMockLcd.Ram[gMockLcd.Page][gMockLcd.Column++] = Value;
+		gMockLcd.DataBytes++;
+		return;
+	}
+
+	gMockLcd.CommandBytes++;
+
+	if ((Value & 0xF0) == 0xB0)
+		gMockLcd.Page = Value & 0x0F;
+	else
+	if ((Value & 0xF0) == 0x10)
+		gMockLcd.Column = (gMockLcd.Column & 0x0F) | ((Value & 0x0F) << 4);
+	else
+	if ((Value & 0xF0) == 0x00)
+		gMockLcd.Column = (gMockLcd.Column & 0xF0) | (Value & 0x0F);
+	else
+	if ((Value & 0xC0) == 0x40)
+		gMockLcd.StartLine = Value & 0x3F;
+}
+
+static void MockSpi_Sync(void)
+{	// shift out whatever the code wrote to WDR since the last register access
+	if (gMockSpi0.WDR != MOCK_WDR_IDLE)
+	{
+		MockLcd_Byte(gMockSpi0.WDR, (gMockGpioB.DATA >> GPIOB_PIN_ST7565_A0) & 1u);
+		gMockSpi0.WDR = MOCK_WDR_IDLE;
+	}
+
+	gMockSpi0.FIFOST = SPI_FIFOST_TFF_BITS_NOT_FULL;
+	gMockSpi0.IF     = 0;   // bit 5 clear, the FIFO has drained
+}
+
+static const uint8_t *MockDma_Source(void)
+{	// MSADDR only holds the low 32 bits of a host pointer, the rest comes from the driver's own statics
+	const uintptr_t High = (uintptr_t)&gMockLcd & ~(uintptr_t)0xFFFFFFFFu;
+	return (const uint8_t *)(High | gMockDmaCh1.MSADDR);
+}
+
+static void MockDma_Step(void)
+{
+	const uint32_t Length = ((gMockDmaCh1.CTR & DMA_CH_CTR_LENGTH_MASK) >> DMA_CH_CTR_LENGTH_SHIFT) + 1u;
+	unsigned int   i;
+
+	if ((gMockDmaCh1.CTR & DMA_CH_CTR_CH_EN_MASK) == 0)
+	{	// channel off, the next enable starts a new transfer
+		gMockDmaDone = 0;
+		return;
+	}
+
+	if ((gMockDmaCtr & DMA_CTR_DMAEN_MASK) == 0 || (gMockSpi0.CR & SPI_CR_TXDMAEN_MASK) == 0)
+		return;
+
+	MockSpi_Sync();
+
+	for (i = 0; i < MOCK_DMA_BYTES_PER_POLL && gMockDmaDone < Length; i++)
+	{
+		MockLcd_Byte(MockDma_Source()[gMockDmaDone++], (gMockGpioB.DATA >> GPIOB_PIN_ST7565_A0) & 1u);
+		gMockLcd.DmaBytes++;
+	}
+}
+
+static volatile SPI_Port_t *MockSpi0(void)
+{
+	MockSpi_Sync();
+	return &gMockSpi0;
+}
+
+static volatile GPIO_Bank_t *MockGpioB(void)
+{	// a byte still in WDR goes out with the A0 level from before this access
+	MockSpi_Sync();
+	return &gMockGpioB;
+}
+
+__attribute__((unused)) static volatile DMA_Channel_t *MockDmaCh1(void)
+{
+	if ((gMockDmaCh1.CTR & DMA_CH_CTR_CH_EN_MASK) == 0)
+		gMockDmaDone = 0;
+	return &gMockDmaCh1;
+}
+
+__attribute__((unused)) static volatile uint32_t *MockDmaIntst(void)
+{	// reads report the transfer complete flag, writes (clear by writing 1) land in the scratch and are lost
+	const uint32_t Length = ((gMockDmaCh1.CTR & DMA_CH_CTR_LENGTH_MASK) >> DMA_CH_CTR_LENGTH_SHIFT) + 1u;
+
+	MockDma_Step();
+
+	gMockDmaIntst = 0;
+	if ((gMockDmaCh1.CTR & DMA_CH_CTR_CH_EN_MASK) != 0 && gMockDmaDone >= Length)
+		gMockDmaIntst = DMA_INTST_CH1_TC_INTST_BITS_SET;
+
+	return &gMockDmaIntst;
+}
+
+static void Mock_Reset(void)
+{
+	memset(&gMockLcd, 0, sizeof(gMockLcd));
+	memset(&gMockSpi0, 0, sizeof(gMockSpi0));
+	memset(&gMockGpioB, 0, sizeof(gMockGpioB));
+	memset(&gMockDmaCh1, 0, sizeof(gMockDmaCh1));
+	gMockSpi0.WDR = MOCK_WDR_IDLE;
+	gMockDmaCtr   = 0;
+	gMockDmaIntst = 0;
+	gMockDmaDone  = 0;
+}
+
+#undef  SPI0
+#define SPI0       (MockSpi0())
+#undef  GPIOB
+#define GPIOB      (MockGpioB())
+#undef  DMA_CH1
+#define DMA_CH1    (MockDmaCh1())
+#undef  DMA_CTR
+#define DMA_CTR    gMockDmaCtr
+#undef  DMA_INTST
+#define DMA_INTST  (*MockDmaIntst())
+
+// driver/spi.c and driver/system.c stand-ins
+void SPI0_Init(void)
+{
+}
+
+void SPI_ToggleMasterMode(volatile uint32_t *pCR, bool bIsMaster)
+{
+	if (bIsMaster)
+		*pCR = (*pCR & ~SPI_CR_MSR_SSN_MASK) | SPI_CR_MSR_SSN_BITS_ENABLE;
+	else
+		*pCR = (*pCR & ~SPI_CR_MSR_SSN_MASK) | SPI_CR_MSR_SSN_BITS_DISABLE;
+}
+
+void SPI_WaitForUndocumentedTxFifoStatusBit(void)
+{
+	MockSpi_Sync();
+}
+
+void SYSTEM_DelayMs(uint32_t Delay)
+{
+	(void)Delay;
+}
+
+#endif